@@ -23,6 +23,8 @@
 #include <stdio.h>
 #include <string.h>
 #include "DRV_TSL2591.h"
+#include "DRV_TSL2591_lux.h"
+#include "dlog.h"
 
 /* ************************************************************************** */
 /* ************************************************************************** */
@@ -74,6 +76,11 @@
 #define TSL2591_REG_C1DATAL             0x16
 #define TSL2591_REG_C1DATAH             0x17
 
+/**
+ * @brief Writable registers held in DATA_TSL2591.shadow (0x02/0x03 are reserved).
+ */
+#define TSL2591_SHADOW_WRITABLE         0x1FF3
+
 /**
  * @brief TSL2591 lux calculation values.
  */
@@ -85,16 +92,96 @@
 #define AMBIENT21_LUX_GDF                   900.0f
 #define AMBIENT21_LUX_COEF                  1.0f
 
+/**
+ * @brief ADC full scale, a channel at or above it is saturated. The lux
+ *  conversion itself is in DRV_TSL2591_lux.c.
+ */
+#define TSL2591_MAX_COUNT_100MS         36863
+#define TSL2591_MAX_COUNT               65535
+
+/**
+ * @brief AGC bands, as a fraction of the maximum count for the integration
+ *  time. A reading outside the trigger band causes a reconfiguration that
+ *  aims for the (narrower) target band, which gives the hysteresis. The
+ *  target band is wider than the largest gain step (x25) so that every
+ *  light level has a configuration landing inside it.
+ */
+#define TSL2591_AGC_HI_TRIGGER(max)     ((max) - ((max) / 16))
+#define TSL2591_AGC_HI_TARGET(max)      ((max) / 2)
+#define TSL2591_AGC_LO_TARGET(max)      ((max) / 64)
+#define TSL2591_AGC_LO_TRIGGER(max)     ((max) / 256)
+
+/**
+ * @brief Report-on-change window.
+ * @details The window never gets narrower than TSL2591_CHANGE_MIN_MARGIN
+ *  counts, so noise at very low levels does not keep re-triggering. A low
+ *  threshold above the high one makes every cycle fall outside the window,
+ *  which is used to force a fresh reading after a configuration change.
+ */
+#define TSL2591_CHANGE_MIN_MARGIN       16
+#define TSL2591_WINDOW_LEN              4       // AILTL, AILTH, AIHTL, AIHTH (or NPAILTL..NPAIHTH)
+
 /**
  * @brief Values to be used within this Driver
  */
 #define TSL2591_DEFAULT_CONFIG          (TSL2591_CONFIG_AGAIN_MID | TSL2591_CONFIG_ATIME_200MS)
 #define TSL2591_ENABLE_READING          (TSL2591_ENABLE_PON | TSL2591_ENABLE_AEN | TSL2591_ENABLE_AIEN)
 #define TSL2591_CLEAR_INTERRUPTS        (TSL2591_COMMAND_SPEC_FUNC | TSL2591_SF_CLEAR_ALS_NOPERS_INT) 
-#define TSL2591_REG_RAWDATA             0x14
+#define TSL2591_SAMPLE_READ_LEN         5       // STATUS, C0DATAL, C0DATAH, C1DATAL, C1DATAH
+
+#if (TSL2591_RING_SIZE & (TSL2591_RING_SIZE - 1)) != 0
+#error "TSL2591_RING_SIZE must be a power of two"
+#endif
+
+/**
+ * @brief Hardware acquisition chain.
+ * @details Three DMAC channels sequence one readout per sensor interrupt:
+ *  the head channel, triggered by EXTINT7 through EVSYS channel 0, writes
+ *  the address of a 1 byte write to SERCOM3; the transmit channel, paced by
+ *  MB, then sends the clear command, addresses the 1 byte STATUS command,
+ *  sends it, and addresses a 5 byte read; the receive channel, paced by SB,
+ *  stores the burst. ADDR.LENEN makes the SERCOM issue NACK and STOP by
+ *  itself. The receive list is a double buffer of TSL2591_CHAIN_BATCH
+ *  records per half, with a block interrupt at the end of each half.
+ */
+#define TSL2591_CHAIN_TX_STEPS          4       // Clear, address, STATUS command, address
+#define TSL2591_CHAIN_RECORDS           (2 * TSL2591_CHAIN_BATCH)
+#define TSL2591_CHAIN_DRAIN_MS          5       // Wait for a readout under way to end, one takes ~1.5 ms at 100 kHz
+#define TSL2591_CHAIN_ACQUIRE_MS        100     // Longer than the I2C transfer timeout, so a hung transfer is recovered first
+
+/**
+ * @brief Bus speed negotiation.
+ * @details At init every speed of busSpeedHz is tried from the fastest
+ *  down, with TSL2591_BUS_PROBE_READS CHIPID reads; the first one that
+ *  returns the right ID every time becomes the ceiling. At run time the
+ *  transfer results are counted in windows of TSL2591_BUS_WINDOW: a window
+ *  with TSL2591_BUS_ERRORS_DOWN bus errors steps one speed down at once,
+ *  TSL2591_BUS_CLEAN_WINDOWS error-free windows in a row step one back up
+ *  towards the ceiling.
+ */
+#define TSL2591_BUS_PROBE_READS         8
+#define TSL2591_BUS_WINDOW              32
+#define TSL2591_BUS_ERRORS_DOWN         2
+#define TSL2591_BUS_CLEAN_WINDOWS       16
+#define TSL2591_BUS_SPEEDS              (sizeof(busSpeedHz) / sizeof(busSpeedHz[0]))
 
 DATA_TSL2591 driverData;
 
+/* The chain owns SERCOM3 and its DMAC channels, so there is one per system */
+static dmac_descriptor_registers_t chainHeadDesc __ALIGNED(16) SECTION_DMAC_DESCRIPTOR;
+static dmac_descriptor_registers_t chainTxDesc[TSL2591_CHAIN_TX_STEPS] __ALIGNED(16) SECTION_DMAC_DESCRIPTOR;
+static dmac_descriptor_registers_t chainRxDesc[TSL2591_CHAIN_RECORDS] __ALIGNED(16) SECTION_DMAC_DESCRIPTOR;
+static uint8_t chainRecords[TSL2591_CHAIN_RECORDS][TSL2591_SAMPLE_READ_LEN];
+static uint32_t chainAddrWrite;
+static uint32_t chainAddrRead;
+static uint8_t chainCommands[2];
+
+/* Relative sensitivity of each AGAIN setting, ATIME scales linearly */
+static const uint16_t agcGain[4] = { 1, 25, 428, 9876 };
+
+/* SCL frequencies tried by the bus speed negotiation, fastest first */
+static const uint32_t busSpeedHz[] = { TSL2591_I2C_SPEED_MAX, 200000, 100000 };
+
 /* ************************************************************************** */
 /* ************************************************************************** */
 // Section: Local Functions                                                   */
@@ -102,6 +189,98 @@ DATA_TSL2591 driverData;
 /* ************************************************************************** */
 
 
+/**
+ * @brief countTransaction - Account for one I2C transaction issued by the driver
+ * @param driver - Driver Object that issued the transaction
+ * @param bytes - Bytes on the wire, address bytes included
+ */
+static inline void countTransaction(DATA_TSL2591* driver, uint8_t bytes) {
+    driver->i2cTransactions++;
+    driver->lastCallTransactions++;
+    driver->busPendingBytes = bytes;
+    driver->busStartCycles = DWT->CYCCNT;
+}
+
+/**
+ * @brief setBusSpeed - Retime this instance's I2C client. Takes effect
+ *  from the next transfer the I2C driver starts for it.
+ * @param driver - Driver Object to use
+ * @param index - Entry of busSpeedHz to use
+ */
+static void setBusSpeed(DATA_TSL2591* driver, uint8_t index) {
+    DRV_I2C_TRANSFER_SETUP setup;
+    
+    setup.clockSpeed = busSpeedHz[index];
+    DRV_I2C_TransferSetup(driver->drvI2CHandle, &setup);
+    
+    driver->busSpeedIndex = index;
+    driver->busWindowCount = 0;
+    driver->busWindowErrors = 0;
+    driver->busCleanWindows = 0;
+    // Throughput is reported for the current speed only
+    driver->busBytes = 0;
+    driver->busCycles = 0;
+}
+
+/**
+ * @brief busComplete - Account for the end of the transaction started by
+ *  the last countTransaction and adjust the bus speed to the error rate.
+ *  Called from task context for blocking transfers and from the I2C
+ *  interrupt context for queued ones.
+ * @param driver - Driver Object that issued the transaction
+ * @param ok - true if the transfer completed
+ */
+static void busComplete(DATA_TSL2591* driver, bool ok) {
+    if(ok) {
+        driver->busBytes += driver->busPendingBytes;
+        driver->busCycles += DWT->CYCCNT - driver->busStartCycles;
+    }
+    else if(DRV_I2C_ErrorGet(driver->drvI2CHandle) == DRV_I2C_ERROR_TIMEOUT) {
+        // Stuck bus, not a marginal speed: the driver has reset it already
+        driver->i2cTimedOut = true;
+        driver->busTimeouts++;
+        return;
+    }
+    else if(DRV_I2C_ErrorGet(driver->drvI2CHandle) != DRV_I2C_ERROR_NONE) {
+        driver->busErrors++;
+        driver->busWindowErrors++;
+    }
+    else {
+        // Never reached the bus (queue full), says nothing about the speed
+        return;
+    }
+    
+    if(driver->busWindowErrors >= TSL2591_BUS_ERRORS_DOWN) {
+        if(driver->busSpeedIndex < (TSL2591_BUS_SPEEDS - 1)) {
+            driver->busStepDowns++;
+            setBusSpeed(driver, driver->busSpeedIndex + 1);
+        }
+        else {
+            driver->busWindowCount = 0;
+            driver->busWindowErrors = 0;
+        }
+        return;
+    }
+    
+    if(++driver->busWindowCount < TSL2591_BUS_WINDOW) {
+        return;
+    }
+    
+    if(driver->busWindowErrors == 0) {
+        driver->busCleanWindows++;
+    }
+    else {
+        driver->busCleanWindows = 0;
+    }
+    driver->busWindowCount = 0;
+    driver->busWindowErrors = 0;
+    
+    if((driver->busCleanWindows >= TSL2591_BUS_CLEAN_WINDOWS) && (driver->busSpeedIndex > driver->busSpeedTop)) {
+        driver->busStepUps++;
+        setBusSpeed(driver, driver->busSpeedIndex - 1);
+    }
+}
+
 /**
  * @brief writeCommand - Deliver the specified command via I2C
  * @param driver - Driver Object to use for I2C Communications
@@ -111,11 +290,16 @@ DATA_TSL2591 driverData;
  * @return - return value from RET_TSL2591 typedef enum
  */
 RET_TSL2591 writeCommand(DATA_TSL2591* driver, char command, char len, bool normalop) {
+    bool ok;
+    
     if(normalop) {
         command |= TSL2591_COMMAND_NORMAL_OP;
     }
     
-    if(!DRV_I2C_WriteTransfer(driver->drvI2CHandle, TSL2591_I2C_ADDRESS, (void *)&command, len)) {
+    countTransaction(driver, len + 1);
+    ok = DRV_I2C_WriteTransfer(driver->drvI2CHandle, TSL2591_I2C_ADDRESS, (void *)&command, len);
+    busComplete(driver, ok);
+    if(!ok) {
         return RET_TSL2591_I2C_DRIVER_ERROR;
     }
     
@@ -123,138 +307,1506 @@ RET_TSL2591 writeCommand(DATA_TSL2591* driver, char command, char len, bool norm
 }
 
 /**
- * @brief writeReadCommand - Deliver the specified command via I2C, then read back values
+ * @brief shadowTrim - Compare a register write against the shadow copy
+ * @param driver - Driver Object holding the shadow
+ * @param reg - First register to write
+ * @param data - Register values to write
+ * @param len - number of registers to write
+ * @param first - Offset in data of the first register that has to be written
+ * @param count - Number of registers from first on that have to be written
+ * @return - false if every register is cached with the same value
+ */
+static bool shadowTrim(DATA_TSL2591* driver, uint8_t reg, const uint8_t* data, uint8_t len, uint8_t* first, uint8_t* count) {
+    uint8_t i, last = 0;
+    bool dirty = false;
+    
+    for(i = 0; i < len; i++) {
+        if(((reg + i) >= TSL2591_SHADOW_SIZE) || !(driver->shadowValid & (1 << (reg + i))) || (driver->shadow[reg + i] != data[i])) {
+            if(!dirty) {
+                *first = i;
+                dirty = true;
+            }
+            last = i;
+        }
+    }
+    
+    if(dirty) {
+        *count = last - *first + 1;
+    }
+    
+    return dirty;
+}
+
+/**
+ * @brief shadowStore - Record register values written to / read from the device
+ * @param driver - Driver Object holding the shadow
+ * @param reg - First register
+ * @param data - Register values
+ * @param len - number of registers
+ * @param valid - false to invalidate the range instead (failed write)
+ */
+static void shadowStore(DATA_TSL2591* driver, uint8_t reg, const uint8_t* data, uint8_t len, bool valid) {
+    uint8_t i;
+    
+    for(i = 0; (i < len) && ((reg + i) < TSL2591_SHADOW_SIZE); i++) {
+        if(valid) {
+            driver->shadow[reg + i] = data[i];
+            driver->shadowValid |= (1 << (reg + i)) & TSL2591_SHADOW_WRITABLE;
+        }
+        else {
+            driver->shadowValid &= ~(1 << (reg + i));
+        }
+    }
+}
+
+/**
+ * @brief writeRegisters - Write one or more consecutive registers in a single
+ *  I2C transaction. The command byte selects reg with the NORMAL OPERATION
+ *  flag, so the TSL2591 auto-increments the address for each payload byte.
+ *  Registers whose shadow copy already holds the value are trimmed from the
+ *  ends of the burst, and the write is skipped entirely if none changed.
  * @param driver - Driver Object to use for I2C Communications
- * @param command - 8 Bit Command to send
- * @param len - length of values to be read (in bytes)
+ * @param reg - First register to write
+ * @param data - Register values to write
+ * @param len - number of registers to write (in bytes)
  * @return - return value from RET_TSL2591 typedef enum
  */
-RET_TSL2591 writeReadCommand(DATA_TSL2591* driver, char command, char len) {
-    char* rxbuffer = (char*)&driver->rxBuffer;
-    command = command | TSL2591_COMMAND_NORMAL_OP;
+RET_TSL2591 writeRegisters(DATA_TSL2591* driver, uint8_t reg, const uint8_t* data, uint8_t len) {
+    uint8_t first, count, command;
+    DRV_I2C_SEGMENT segments[2];
+    bool ok;
+    
+    if((len == 0) || (len > TSL2591_SHADOW_SIZE)) {
+        return RET_TSL2591_INVALID_LENGTH;
+    }
+    
+    if(!shadowTrim(driver, reg, data, len, &first, &count)) {
+        driver->writesElided++;
+        return RET_TSL2591_SUCCESS;
+    }
+    
+    // Command byte and payload go out as one transaction, straight from
+    // the caller's buffer
+    command = (reg + first) | TSL2591_COMMAND_NORMAL_OP;
+    segments[0].buffer = &command;
+    segments[0].length = 1;
+    segments[1].buffer = (uint8_t*)&data[first];
+    segments[1].length = count;
     
-    if(!DRV_I2C_WriteReadTransfer(driver->drvI2CHandle, TSL2591_I2C_ADDRESS, (void*)&command, 1, (void *)rxbuffer, len)) {
+    countTransaction(driver, count + 2);
+    ok = DRV_I2C_WriteVectorTransfer(driver->drvI2CHandle, TSL2591_I2C_ADDRESS, segments, 2);
+    busComplete(driver, ok);
+    if(!ok) {
+        shadowStore(driver, reg + first, &data[first], count, false);
         return RET_TSL2591_I2C_DRIVER_ERROR;
     }
+    shadowStore(driver, reg + first, &data[first], count, true);
     
     return RET_TSL2591_SUCCESS;
 }
 
+/**
+ * @brief queueShadowWrite - Queue a write of registers already stored in
+ *  the shadow copy. The payload is sent from the shadow itself, only the
+ *  command byte is staged in txBuffer.
+ * @param driver - Driver Object to use for I2C Communications
+ * @param reg - First register to write
+ * @param count - number of registers to write
+ * @param transferHandle - Handle of the queued transfer, or DRV_I2C_TRANSFER_HANDLE_INVALID
+ */
+static void queueShadowWrite(DATA_TSL2591* driver, uint8_t reg, uint8_t count, DRV_I2C_TRANSFER_HANDLE* transferHandle) {
+    driver->txBuffer[0] = reg | TSL2591_COMMAND_NORMAL_OP;
+    driver->txSegments[0].buffer = driver->txBuffer;
+    driver->txSegments[0].length = 1;
+    driver->txSegments[1].buffer = &driver->shadow[reg];
+    driver->txSegments[1].length = count;
+    
+    countTransaction(driver, count + 2);
+    DRV_I2C_WriteVectorTransferAdd(driver->drvI2CHandle, TSL2591_I2C_ADDRESS, driver->txSegments, 2, transferHandle);
+}
 
+/**
+ * @brief stepsBegin - Start staging an I2C driver chain in txSteps. The
+ *  transactions of a chain are started one after the other from the I2C
+ *  completion interrupt, the caller only hears back at the end.
+ * @param driver - Driver Object to use
+ */
+static void stepsBegin(DATA_TSL2591* driver) {
+    driver->txStepCount = 0;
+    driver->txUsed = 0;
+    driver->txStepBytes = 0;
+}
 
-/* ************************************************************************** */
-/* ************************************************************************** */
-// Section: Interface Functions                                               */
-/* ************************************************************************** */
-/* ************************************************************************** */
-
+/**
+ * @brief stepsAdd - Stage one write transaction of bytes already in
+ *  txBuffer, from txUsed on
+ * @param driver - Driver Object to use
+ * @param len - Bytes to write
+ */
+static void stepsAdd(DATA_TSL2591* driver, uint8_t len) {
+    DRV_I2C_CHAIN_TRANSFER* step = &driver->txSteps[driver->txStepCount++];
+    
+    step->address = TSL2591_I2C_ADDRESS;
+    step->writeBuffer = &driver->txBuffer[driver->txUsed];
+    step->writeSize = len;
+    step->readBuffer = NULL;
+    step->readSize = 0;
+    
+    driver->txUsed += len;
+    driver->txStepBytes += len + 1;
+}
 
-RET_TSL2591 DRV_TSL2591_Initialize(DATA_TSL2591* instance, int intpin) {
-    instance->drvI2CHandle = DRV_I2C_Open(instance->drvIndex, DRV_IO_INTENT_READWRITE);
-    instance->interruptPin = intpin;
+/**
+ * @brief stepsAddRegisters - Stage a register write, trimmed against the
+ *  shadow like writeRegisters. The shadow is updated right away so that a
+ *  later step of the same chain is trimmed against it; stepsRun and the
+ *  queued completion drop the whole shadow if the chain fails.
+ * @param driver - Driver Object to use
+ * @param reg - First register to write
+ * @param data - Register values to write
+ * @param len - number of registers to write
+ */
+static void stepsAddRegisters(DATA_TSL2591* driver, uint8_t reg, const uint8_t* data, uint8_t len) {
+    uint8_t first, count;
     
-    if(instance->drvI2CHandle == DRV_HANDLE_INVALID) {
-        printf("TSL2591 Invalid I2C Driver Handle\r\n");
-        return RET_TSL2591_INVALID_I2C;
-    }
-    else {
-        printf("TSL2591 Driver Init OK\r\n");
+    if(!shadowTrim(driver, reg, data, len, &first, &count)) {
+        driver->writesElided++;
+        return;
     }
     
-    writeReadCommand(instance, TSL2591_REG_CHIPID, 1);
+    driver->txBuffer[driver->txUsed] = (reg + first) | TSL2591_COMMAND_NORMAL_OP;
+    memcpy(&driver->txBuffer[driver->txUsed + 1], &data[first], count);
+    shadowStore(driver, reg + first, &data[first], count, true);
+    stepsAdd(driver, count + 1);
+}
 
-    if(instance->rxBuffer[0] == TSL2591_VAL_CHIPID) {
-        printf("TSL2591 ChipID Found: 0x%x\r\n", instance->rxBuffer[0]);
-    }
-    else {
-        printf("TSL2591 ChipID Invalid: 0x%x\r\n", instance->rxBuffer[0]);
-        return RET_TSL2591_INVALID_CHIPID;
-    }
+/**
+ * @brief stepsAddCommand - Stage a special function command
+ * @param driver - Driver Object to use
+ * @param command - Command byte, e.g. TSL2591_CLEAR_INTERRUPTS
+ */
+static void stepsAddCommand(DATA_TSL2591* driver, uint8_t command) {
+    driver->txBuffer[driver->txUsed] = command;
+    stepsAdd(driver, 1);
+}
+
+/**
+ * @brief stepsCount - Account for the staged chain as one bus transfer
+ * @param driver - Driver Object to use
+ */
+static void stepsCount(DATA_TSL2591* driver) {
+    driver->i2cTransactions += driver->txStepCount;
+    driver->lastCallTransactions += driver->txStepCount;
+    driver->busPendingBytes = driver->txStepBytes;
+    driver->busStartCycles = DWT->CYCCNT;
+}
 
-    DRV_TSL2591_SetConfig(instance, TSL2591_CONFIG_AGAIN_MID, TSL2591_CONFIG_ATIME_200MS);
+/**
+ * @brief stepsRun - Run the staged chain and block until it is done
+ * @param driver - Driver Object to use
+ * @return - return value from RET_TSL2591 typedef enum
+ */
+static RET_TSL2591 stepsRun(DATA_TSL2591* driver) {
+    bool ok;
     
-    if(writeCommand(instance, TSL2591_REG_ENABLE, 1, true) != RET_TSL2591_SUCCESS) {
-        return RET_TSL2591_ERROR_UNKNOWN;
+    if(driver->txStepCount == 0) {
+        return RET_TSL2591_SUCCESS;
     }
     
-    if(writeCommand(instance, TSL2591_ENABLE_READING, 1, false) != RET_TSL2591_SUCCESS) {
-        return RET_TSL2591_ERROR_UNKNOWN;
+    stepsCount(driver);
+    ok = DRV_I2C_ChainTransfer(driver->drvI2CHandle, driver->txSteps, driver->txStepCount);
+    busComplete(driver, ok);
+    if(!ok) {
+        // The failed step is not known, nor whether it reached the device
+        driver->shadowValid = 0;
+        return RET_TSL2591_I2C_DRIVER_ERROR;
     }
     
-    if(writeReadCommand(instance, TSL2591_CLEAR_INTERRUPTS, 1) != RET_TSL2591_SUCCESS) {
-        return RET_TSL2591_ERROR_UNKNOWN;
-    }
     return RET_TSL2591_SUCCESS;
 }
 
-RET_TSL2591 DRV_TSL2591_GetRawValue(DATA_TSL2591* instance) {
-    if(instance->drvI2CHandle == DRV_HANDLE_INVALID) {
-        printf("TSL2591 Invalid I2C Driver Handle\r\n");
-        return RET_TSL2591_INVALID_I2C;
-    }
+/**
+ * @brief writeReadCommand - Deliver the specified command via I2C, then read back values
+ * @param driver - Driver Object to use for I2C Communications
+ * @param command - 8 Bit Command to send
+ * @param len - length of values to be read (in bytes)
+ * @return - return value from RET_TSL2591 typedef enum
+ */
+RET_TSL2591 writeReadCommand(DATA_TSL2591* driver, char command, char len) {
+    char* rxbuffer = (char*)&driver->rxBuffer;
+    bool ok;
+    command = command | TSL2591_COMMAND_NORMAL_OP;
     
-    if(writeReadCommand(instance, TSL2591_CLEAR_INTERRUPTS, 1) != RET_TSL2591_SUCCESS) {
-        return RET_TSL2591_ERROR_UNKNOWN;
+    countTransaction(driver, len + 3);
+    ok = DRV_I2C_WriteReadTransfer(driver->drvI2CHandle, TSL2591_I2C_ADDRESS, (void*)&command, 1, (void *)rxbuffer, len);
+    busComplete(driver, ok);
+    if(!ok) {
+        return RET_TSL2591_I2C_DRIVER_ERROR;
     }
     
-    if(writeReadCommand(instance, TSL2591_REG_RAWDATA, 4) != RET_TSL2591_SUCCESS) {
-        return RET_TSL2591_ERROR_UNKNOWN;
+    return RET_TSL2591_SUCCESS;
+}
+
+/**
+ * @brief readShadow - Return a register value, from the shadow if cached,
+ *  from the device otherwise
+ * @param driver - Driver Object to use for I2C Communications
+ * @param reg - Register to read
+ * @param value - Register value
+ * @return - return value from RET_TSL2591 typedef enum
+ */
+static RET_TSL2591 readShadow(DATA_TSL2591* driver, uint8_t reg, uint8_t* value) {
+    if(!(driver->shadowValid & (1 << reg))) {
+        if(writeReadCommand(driver, reg, 1) != RET_TSL2591_SUCCESS) {
+            return RET_TSL2591_I2C_DRIVER_ERROR;
+        }
+        shadowStore(driver, reg, (uint8_t*)driver->rxBuffer, 1, true);
     }
     
-    // Perform CHO/CH1 -> Lux calculations
-    uint16_t ch0, ch1;
-    
-    ch0 = (instance->rxBuffer[1]<<8) | instance->rxBuffer[0];
-    ch1 = (instance->rxBuffer[3]<<8) | instance->rxBuffer[2];
-    
-    instance->lux = (int) ((((float) ch0-ch1) * (1.0 - (float) ch1/ch0)) / instance->cpl);
+    *value = driver->shadow[reg];
     
     return RET_TSL2591_SUCCESS;
 }
 
-RET_TSL2591 DRV_TSL2591_SetConfig(DATA_TSL2591* instance, uint8_t again, uint8_t atime) {
-        
-    if(writeCommand(instance, TSL2591_REG_CONFIG, 1, true) != RET_TSL2591_SUCCESS) {
-        return RET_TSL2591_ERROR_UNKNOWN;
+/**
+ * @brief updateRegisterBits - Read-modify-write a register against its
+ *  shadow copy; no bus access at all if the bits are already as requested
+ * @param driver - Driver Object to use for I2C Communications
+ * @param reg - Register to update
+ * @param clear - Bits to clear
+ * @param set - Bits to set
+ * @return - return value from RET_TSL2591 typedef enum
+ */
+static RET_TSL2591 updateRegisterBits(DATA_TSL2591* driver, uint8_t reg, uint8_t clear, uint8_t set) {
+    uint8_t value;
+    
+    if(readShadow(driver, reg, &value) != RET_TSL2591_SUCCESS) {
+        return RET_TSL2591_I2C_DRIVER_ERROR;
     }
-    if(writeCommand(instance, (again | atime) , 1, false) != RET_TSL2591_SUCCESS) {
-        return RET_TSL2591_ERROR_UNKNOWN;
-    }   
+    
+    value = (value & ~clear) | set;
+    
+    return writeRegisters(driver, reg, &value, 1);
+}
 
+/**
+ * @brief updateConfigValues - Update the cached gain/time values used by the
+ *  lux calculation after CONFIG has been written
+ * @param driver - Driver Object to update
+ * @param again - Gain setting (TSL2591_CONFIG_AGAIN_xxx)
+ * @param atime - Integration time setting (TSL2591_CONFIG_ATIME_xxx)
+ */
+static void updateConfigValues(DATA_TSL2591* driver, uint8_t again, uint8_t atime) {
+    driver->config = again | atime;
+    
     switch (again) {
         case TSL2591_CONFIG_AGAIN_LOW:
-            instance->again = AMBIENT21_GAIN_0;
+            driver->again = AMBIENT21_GAIN_0;
             break;
         case TSL2591_CONFIG_AGAIN_MID:
-            instance->again = AMBIENT21_GAIN_1;
+            driver->again = AMBIENT21_GAIN_1;
             break;
         case TSL2591_CONFIG_AGAIN_HIGH:
-            instance->again = AMBIENT21_GAIN_2;
+            driver->again = AMBIENT21_GAIN_2;
             break;
         case TSL2591_CONFIG_AGAIN_MAX:
-            instance->again = AMBIENT21_GAIN_3;
+            driver->again = AMBIENT21_GAIN_3;
             break;
         default:
-            instance->again = AMBIENT21_GAIN_0;
+            driver->again = AMBIENT21_GAIN_0;
             break;
     }
-    instance->atime_ms = AMBIENT21_TIME_RES + AMBIENT21_TIME_RES * atime;
-    instance->cpl = (instance->atime_ms * instance->again) / AMBIENT21_LUX_GDF;
+    driver->atime_ms = AMBIENT21_TIME_RES + AMBIENT21_TIME_RES * atime;
+    driver->cpl = (driver->atime_ms * driver->again) / AMBIENT21_LUX_GDF;
+}
+
+/**
+ * @brief applyConfig - Program the CONFIG register and update the cached
+ *  gain/time values used by the lux calculation
+ * @param driver - Driver Object to use for I2C Communications
+ * @param again - Gain setting (TSL2591_CONFIG_AGAIN_xxx)
+ * @param atime - Integration time setting (TSL2591_CONFIG_ATIME_xxx)
+ * @return - return value from RET_TSL2591 typedef enum
+ */
+static RET_TSL2591 applyConfig(DATA_TSL2591* driver, uint8_t again, uint8_t atime) {
+    uint8_t config = again | atime;
+    
+    if(writeRegisters(driver, TSL2591_REG_CONFIG, &config, 1) != RET_TSL2591_SUCCESS) {
+        return RET_TSL2591_ERROR_UNKNOWN;
+    }
+
+    updateConfigValues(driver, again, atime);
     
     return RET_TSL2591_SUCCESS;
 }
 
-RET_TSL2591 DRV_TSL2591_RegisterCallback(DATA_TSL2591* instance, TSL2591_Event_CallBack cb, void* context) {
-    if(cb == NULL) {
-        return RET_TSL2591_NULL_CALLBACK; 
+/**
+ * @brief maxCount - ADC full scale for an integration time setting
+ * @param atime - Integration time setting (TSL2591_CONFIG_ATIME_xxx)
+ * @return - Maximum channel count
+ */
+static inline uint16_t maxCount(uint8_t atime) {
+    return (atime == TSL2591_CONFIG_ATIME_100MS) ? TSL2591_MAX_COUNT_100MS : TSL2591_MAX_COUNT;
+}
+
+/**
+ * @brief agcSelectConfig - Pick the configuration for the next integration
+ * @details Configurations are tried shortest integration time first and,
+ *  for each time, highest gain first; the first one whose predicted count
+ *  lands in the target band wins. Gain is therefore the primary knob and
+ *  integration time is only extended once gain alone can not lift the
+ *  reading off the noise floor.
+ * @param config - Configuration the reading was taken with
+ * @param peak - Larger of ch0/ch1
+ * @param saturated - Reading hit the ADC limit, peak is only a lower bound
+ * @return - New configuration, equal to config if no change is needed
+ */
+static uint8_t agcSelectConfig(uint8_t config, uint16_t peak, bool saturated) {
+    uint8_t gain = (config & TSL2591_CONFIG_AGAIN_MASK) >> 4;
+    uint8_t time = config & TSL2591_CONFIG_ATIME_MASK;
+    uint32_t scale, predicted;
+    uint8_t g, t;
+    
+    if(saturated) {
+        // True level unknown: fall to the lowest gain, then the shortest time
+        if(gain != 0) {
+            return TSL2591_CONFIG_AGAIN_LOW | time;
+        }
+        return TSL2591_CONFIG_AGAIN_LOW | TSL2591_CONFIG_ATIME_100MS;
     }
-    instance->callBack = cb;
     
-    EIC_CallbackRegister(instance->interruptPin, (EIC_CALLBACK)instance->callBack, (uintptr_t)context);
+    if((peak >= TSL2591_AGC_LO_TRIGGER(maxCount(time))) && (peak <= TSL2591_AGC_HI_TRIGGER(maxCount(time)))) {
+        return config;
+    }
+    
+    // peak * gain' * time' stays below 2^32 for 16-bit counts
+    scale = (uint32_t)agcGain[gain] * (time + 1);
+    for(t = TSL2591_CONFIG_ATIME_100MS; t <= TSL2591_CONFIG_ATIME_600MS; t++) {
+        for(g = 4; g-- > 0; ) {
+            predicted = ((uint32_t)peak * agcGain[g] * (t + 1)) / scale;
+            if(predicted <= TSL2591_AGC_HI_TARGET(maxCount(t))) {
+                if(predicted >= TSL2591_AGC_LO_TARGET(maxCount(t))) {
+                    return (g << 4) | t;
+                }
+                break;
+            }
+        }
+        if((t == TSL2591_CONFIG_ATIME_100MS) && (g == 0xFF)) {
+            // Too bright even at the lowest sensitivity
+            return TSL2591_CONFIG_AGAIN_LOW | TSL2591_CONFIG_ATIME_100MS;
+        }
+    }
+    
+    // Too dark even at the highest sensitivity
+    return TSL2591_CONFIG_AGAIN_MAX | TSL2591_CONFIG_ATIME_600MS;
+}
+
+/**
+ * @brief buildWindow - Fill AILTL..AIHTH for a window around the last ch0
+ * @param driver - Driver Object holding the last reading
+ * @param window - Destination for the four threshold bytes
+ * @param force - Build an inverted window that trips on the next cycle
+ */
+static void buildWindow(DATA_TSL2591* driver, uint8_t* window, bool force) {
+    uint32_t margin, low, high;
+    
+    if(force) {
+        low = 0xFFFF;
+        high = 0;
+    }
+    else {
+        margin = ((uint32_t)driver->ch0 * driver->changeWindowPercent) / 100;
+        if(margin < TSL2591_CHANGE_MIN_MARGIN) {
+            margin = TSL2591_CHANGE_MIN_MARGIN;
+        }
+        low = (driver->ch0 > margin) ? driver->ch0 - margin : 0;
+        high = driver->ch0 + margin;
+        if(high > 0xFFFF) {
+            high = 0xFFFF;
+        }
+    }
+    
+    window[0] = low & 0xFF;
+    window[1] = low >> 8;
+    window[2] = high & 0xFF;
+    window[3] = high >> 8;
+}
+
+/**
+ * @brief ringPush - Append the decoded sample to the ring. Only ever called
+ *  by the instance owner (claimed sync call or the async read completion),
+ *  so there is a single producer at any time.
+ * @param driver - Driver Object holding the sample
+ */
+static void ringPush(DATA_TSL2591* driver) {
+    uint32_t head = driver->ringHead;
+    TSL2591_SAMPLE* sample;
+    
+    if((head - driver->ringTail) >= TSL2591_RING_SIZE) {
+        driver->ringOverflows++;
+        return;
+    }
+    
+    sample = &driver->ring[head & (TSL2591_RING_SIZE - 1)];
+    sample->tick = xTaskGetTickCountFromISR();
+    sample->ch0 = driver->ch0;
+    sample->ch1 = driver->ch1;
+    sample->config = driver->config;
+    sample->status = driver->status;
+    
+    // Publish the record before the index that makes it visible
+    __DMB();
+    driver->ringHead = head + 1;
+}
+
+/**
+ * @brief decodeSample - Decode a STATUS..C1DATAH burst held in rxBuffer
+ * @param driver - Driver Object holding the burst
+ * @return - RET_TSL2591_SUCCESS, or RET_TSL2591_DATA_NOT_VALID if AVALID is clear
+ */
+static RET_TSL2591 decodeSample(DATA_TSL2591* driver) {
+    uint16_t ch0, ch1;
+    
+    driver->status = driver->rxBuffer[0];
+    
+    if(!(driver->status & TSL2591_STATUS_AVALID)) {
+        return RET_TSL2591_DATA_NOT_VALID;
+    }
+    
+    // Perform CHO/CH1 -> Lux calculations
+    ch0 = ((uint8_t)driver->rxBuffer[2]<<8) | (uint8_t)driver->rxBuffer[1];
+    ch1 = ((uint8_t)driver->rxBuffer[4]<<8) | (uint8_t)driver->rxBuffer[3];
+    driver->ch0 = ch0;
+    driver->ch1 = ch1;
+    ringPush(driver);
+    
+    if(DRV_TSL2591_ComputeMilliLux(driver->config, ch0, ch1, &driver->milliLux) != RET_TSL2591_SUCCESS) {
+        driver->lux = TSL2591_LUX_SATURATED;
+        return RET_TSL2591_SATURATED;
+    }
+    driver->lux = (int)(driver->milliLux / 1000);
     
     return RET_TSL2591_SUCCESS;
 }
 
+/**
+ * @brief callResult - Report a failed call as RET_TSL2591_I2C_TIMEOUT if one
+ *  of its transfers was aborted by the I2C driver timeout
+ * @param driver - Driver Object that made the call
+ * @param ret - Result of the call
+ * @return - ret, or RET_TSL2591_I2C_TIMEOUT
+ */
+static RET_TSL2591 callResult(DATA_TSL2591* driver, RET_TSL2591 ret) {
+    if(driver->i2cTimedOut && ((ret == RET_TSL2591_I2C_DRIVER_ERROR) ||
+            (ret == RET_TSL2591_INVALID_CHIPID) || (ret == RET_TSL2591_ERROR_UNKNOWN))) {
+        return RET_TSL2591_I2C_TIMEOUT;
+    }
+    return ret;
+}
+
+/**
+ * @brief finishAsync - Complete the pending asynchronous operation and
+ *  notify the application
+ * @param driver - Driver Object that owns the operation
+ * @param result - Result to deliver
+ */
+static void finishAsync(DATA_TSL2591* driver, RET_TSL2591 result) {
+    TSL2591_Async_CallBack cb = driver->asyncCallBack;
+    
+    // Release the instance first, so the callback may queue the next request
+    driver->asyncState = TSL2591_ASYNC_IDLE;
+    
+    if(cb != NULL) {
+        cb(driver, result, driver->asyncContext);
+    }
+}
+
+/**
+ * @brief queueUpdateOrFinish - Last step of an asynchronous sample: queue
+ *  the window re-centre and the interrupt clear the sample read calls for
+ *  as one chain, or complete if there is nothing to write
+ * @param driver - Driver Object that owns the operation
+ */
+static void queueUpdateOrFinish(DATA_TSL2591* driver) {
+    DRV_I2C_TRANSFER_HANDLE updateHandle;
+    uint8_t window[TSL2591_WINDOW_LEN];
+    
+    stepsBegin(driver);
+    
+    // Re-centre the window before clearing the interrupt it raised
+    if(driver->changeMode && (driver->asyncResult != RET_TSL2591_DATA_NOT_VALID)) {
+        buildWindow(driver, window, false);
+        stepsAddRegisters(driver, TSL2591_REG_AILTL, window, TSL2591_WINDOW_LEN);
+    }
+    
+    if(driver->oneShot && (driver->asyncResult != RET_TSL2591_DATA_NOT_VALID)) {
+        driver->oneShotStats.samples++;
+    }
+    
+    // In one-shot mode the pending interrupt keeps the device asleep
+    if(!driver->oneShot && (driver->status & (TSL2591_STATUS_AINT | TSL2591_STATUS_NPINTR))) {
+        stepsAddCommand(driver, TSL2591_CLEAR_INTERRUPTS);
+    }
+    
+    if(driver->txStepCount == 0) {
+        finishAsync(driver, driver->asyncResult);
+        return;
+    }
+    
+    driver->asyncState = TSL2591_ASYNC_SAMPLE_UPDATE;
+    stepsCount(driver);
+    DRV_I2C_ChainTransferAdd(driver->drvI2CHandle, driver->txSteps, driver->txStepCount, &updateHandle);
+    if(updateHandle == DRV_I2C_TRANSFER_HANDLE_INVALID) {
+        driver->shadowValid = 0;
+        finishAsync(driver, RET_TSL2591_I2C_DRIVER_ERROR);
+    }
+}
+
+/**
+ * @brief i2cEventHandler - I2C driver transfer event handler, advances the
+ *  pending asynchronous operation. Runs in the I2C interrupt context, or in
+ *  task context for a transfer retired on its timeout.
+ * @param event - Transfer completion event
+ * @param transferHandle - Handle of the completed transfer
+ * @param context - DATA_TSL2591 object that queued the transfer
+ */
+static void i2cEventHandler(DRV_I2C_TRANSFER_EVENT event, DRV_I2C_TRANSFER_HANDLE transferHandle, uintptr_t context) {
+    DATA_TSL2591* driver = (DATA_TSL2591*)context;
+    
+    busComplete(driver, event == DRV_I2C_TRANSFER_EVENT_COMPLETE);
+    
+    if(event != DRV_I2C_TRANSFER_EVENT_COMPLETE) {
+        // Whatever was being written may or may not have reached the device
+        driver->shadowValid = 0;
+        finishAsync(driver, callResult(driver, RET_TSL2591_I2C_DRIVER_ERROR));
+        return;
+    }
+    
+    switch(driver->asyncState) {
+        case TSL2591_ASYNC_SAMPLE_READ:
+            driver->asyncResult = decodeSample(driver);
+            queueUpdateOrFinish(driver);
+            break;
+        case TSL2591_ASYNC_SAMPLE_UPDATE:
+            finishAsync(driver, driver->asyncResult);
+            break;
+        case TSL2591_ASYNC_CONFIG:
+            updateConfigValues(driver, driver->asyncConfig & TSL2591_CONFIG_AGAIN_MASK, driver->asyncConfig & TSL2591_CONFIG_ATIME_MASK);
+            finishAsync(driver, RET_TSL2591_SUCCESS);
+            break;
+        case TSL2591_ASYNC_IDLE:
+        default:
+            break;
+    }
+}
+
+/**
+ * @brief chainDescriptor - Fill in one descriptor of the acquisition chain
+ * @param desc - Descriptor to fill in
+ * @param btctrl - BEATSIZE, SRCINC/DSTINC and BLOCKACT settings
+ * @param src - Source start address
+ * @param dst - Destination start address
+ * @param count - Number of beats
+ * @param next - Next descriptor in the list
+ */
+static void chainDescriptor(dmac_descriptor_registers_t* desc, uint16_t btctrl, const volatile void* src, volatile void* dst, uint16_t count, const dmac_descriptor_registers_t* next) {
+    uint32_t bytes = (uint32_t)count << ((btctrl & DMAC_BTCTRL_BEATSIZE_Msk) >> DMAC_BTCTRL_BEATSIZE_Pos);
+    
+    // The DMAC wants the end address of an incrementing side
+    desc->DMAC_BTCTRL = DMAC_BTCTRL_VALID_Msk | btctrl;
+    desc->DMAC_BTCNT = count;
+    desc->DMAC_SRCADDR = (uint32_t)src + ((btctrl & DMAC_BTCTRL_SRCINC_Msk) ? bytes : 0U);
+    desc->DMAC_DSTADDR = (uint32_t)dst + ((btctrl & DMAC_BTCTRL_DSTINC_Msk) ? bytes : 0U);
+    desc->DMAC_DESCADDR = (uint32_t)next;
+}
+
+/**
+ * @brief chainBuild - Build the circular descriptor lists of the acquisition chain
+ */
+static void chainBuild(void) {
+    sercom_i2cm_registers_t* regs = DRV_TSL2591_CHAIN_I2C_REGS;
+    uint16_t blockAction;
+    uint32_t i;
+    
+    chainAddrWrite = SERCOM_I2CM_ADDR_ADDR(TSL2591_I2C_ADDRESS << 1) | SERCOM_I2CM_ADDR_LENEN_Msk | SERCOM_I2CM_ADDR_LEN(1);
+    chainAddrRead = SERCOM_I2CM_ADDR_ADDR((TSL2591_I2C_ADDRESS << 1) | 1) | SERCOM_I2CM_ADDR_LENEN_Msk | SERCOM_I2CM_ADDR_LEN(TSL2591_SAMPLE_READ_LEN);
+    chainCommands[0] = TSL2591_CLEAR_INTERRUPTS;
+    chainCommands[1] = TSL2591_COMMAND_NORMAL_OP | TSL2591_REG_STATUS;
+    
+    // One address write per event, the list loops on itself
+    chainDescriptor(&chainHeadDesc, DMAC_BTCTRL_BEATSIZE_WORD, &chainAddrWrite, &regs->SERCOM_ADDR, 1, &chainHeadDesc);
+    
+    chainDescriptor(&chainTxDesc[0], DMAC_BTCTRL_BEATSIZE_BYTE, &chainCommands[0], &regs->SERCOM_DATA, 1, &chainTxDesc[1]);
+    chainDescriptor(&chainTxDesc[1], DMAC_BTCTRL_BEATSIZE_WORD, &chainAddrWrite, &regs->SERCOM_ADDR, 1, &chainTxDesc[2]);
+    chainDescriptor(&chainTxDesc[2], DMAC_BTCTRL_BEATSIZE_BYTE, &chainCommands[1], &regs->SERCOM_DATA, 1, &chainTxDesc[3]);
+    chainDescriptor(&chainTxDesc[3], DMAC_BTCTRL_BEATSIZE_WORD, &chainAddrRead, &regs->SERCOM_ADDR, 1, &chainTxDesc[0]);
+    
+    for(i = 0; i < TSL2591_CHAIN_RECORDS; i++) {
+        blockAction = ((i % TSL2591_CHAIN_BATCH) == (TSL2591_CHAIN_BATCH - 1)) ? DMAC_BTCTRL_BLOCKACT_INT : DMAC_BTCTRL_BLOCKACT_NOACT;
+        chainDescriptor(&chainRxDesc[i], DMAC_BTCTRL_BEATSIZE_BYTE | DMAC_BTCTRL_DSTINC_Msk | blockAction,
+                &regs->SERCOM_DATA, chainRecords[i], TSL2591_SAMPLE_READ_LEN, &chainRxDesc[(i + 1) % TSL2591_CHAIN_RECORDS]);
+    }
+}
+
+/**
+ * @brief chainDrained - Tell whether the chain is between two readouts
+ * @details The transmit list is parked on the clear, waiting for the
+ *  address the head writes, the receive list is on a record boundary and
+ *  the bus is released. The write-back descriptor shows a finished block
+ *  either as done or as the next one loaded, both count.
+ * @return - true if no readout is in progress
+ */
+static bool chainDrained(void) {
+    sercom_i2cm_registers_t* regs = DRV_TSL2591_CHAIN_I2C_REGS;
+    const dmac_descriptor_registers_t* txNext = DMAC_ChannelNextDescriptorGet(DRV_TSL2591_CHAIN_TX_CHANNEL);
+    uint16_t txBeats = DMAC_ChannelRemainingBeatsGet(DRV_TSL2591_CHAIN_TX_CHANNEL);
+    uint16_t rxBeats = DMAC_ChannelRemainingBeatsGet(DRV_TSL2591_CHAIN_RX_CHANNEL);
+    
+    if(!(((txNext == &chainTxDesc[1]) && (txBeats == 1U)) || ((txNext == &chainTxDesc[0]) && (txBeats == 0U)))) {
+        return false;
+    }
+    if((rxBeats != TSL2591_SAMPLE_READ_LEN) && (rxBeats != 0U)) {
+        return false;
+    }
+    // An address the head has just written may not show in BUSSTATE yet
+    if((regs->SERCOM_SYNCBUSY & SERCOM_I2CM_SYNCBUSY_SYSOP_Msk) != 0U) {
+        return false;
+    }
+    return (regs->SERCOM_STATUS & SERCOM_I2CM_STATUS_BUSSTATE_Msk) == SERCOM_I2CM_STATUS_BUSSTATE(1U);
+}
+
+/**
+ * @brief chainEventHandler - DMAC receive channel event handler, decodes
+ *  the half of the record buffer that has just been filled into the ring.
+ *  Runs in the DMAC interrupt context.
+ * @param event - Transfer event
+ * @param context - DATA_TSL2591 object that started the chain
+ */
+static void chainEventHandler(DMAC_TRANSFER_EVENT event, uintptr_t context) {
+    DATA_TSL2591* driver = (DATA_TSL2591*)context;
+    uint32_t first, i;
+    
+    if(event != DMAC_TRANSFER_EVENT_COMPLETE) {
+        driver->chainErrors++;
+        return;
+    }
+    
+    first = driver->chainHalf * TSL2591_CHAIN_BATCH;
+    driver->chainHalf ^= 1;
+    
+    // The DMAC is filling the other half meanwhile
+    for(i = first; i < (first + TSL2591_CHAIN_BATCH); i++) {
+        memcpy(driver->rxBuffer, chainRecords[i], TSL2591_SAMPLE_READ_LEN);
+        (void)decodeSample(driver);
+    }
+    driver->chainBatches++;
+    
+    if(driver->asyncCallBack != NULL) {
+        driver->asyncCallBack(driver, RET_TSL2591_SUCCESS, driver->asyncContext);
+    }
+}
+
+/**
+ * @brief startAsync - Claim the instance for an asynchronous operation
+ * @param driver - Driver Object to use
+ * @param state - First state of the operation
+ * @param cb - Callback to trigger when the operation has finished
+ * @param context - User Data to be delivered back through the callback
+ * @return - RET_TSL2591_SUCCESS, or RET_TSL2591_BUSY if an operation is pending
+ */
+static RET_TSL2591 startAsync(DATA_TSL2591* driver, TSL2591_ASYNC_STATE state, TSL2591_Async_CallBack cb, uintptr_t context) {
+    bool intState;
+    RET_TSL2591 ret = RET_TSL2591_SUCCESS;
+    
+    intState = SYS_INT_Disable();
+    if(driver->asyncState != TSL2591_ASYNC_IDLE) {
+        ret = RET_TSL2591_BUSY;
+    }
+    else {
+        driver->asyncState = state;
+    }
+    SYS_INT_Restore(intState);
+    
+    if(ret == RET_TSL2591_SUCCESS) {
+        driver->asyncCallBack = cb;
+        driver->asyncContext = context;
+        driver->lastCallTransactions = 0;
+        driver->i2cTimedOut = false;
+    }
+    
+    return ret;
+}
+
+
+/**
+ * @brief claimSync - Claim the instance for a blocking call, so that an
+ *  asynchronous request issued from an interrupt in the meantime gets
+ *  RET_TSL2591_BUSY instead of sharing the transfer buffers
+ * @param driver - Driver Object to use
+ * @return - RET_TSL2591_SUCCESS, or RET_TSL2591_BUSY if an operation is pending
+ */
+static RET_TSL2591 claimSync(DATA_TSL2591* driver) {
+    return startAsync(driver, TSL2591_ASYNC_SYNC, NULL, 0);
+}
+
+/**
+ * @brief releaseSync - Release the instance claimed by claimSync
+ * @param driver - Driver Object to use
+ * @param ret - Result of the blocking call
+ * @return - ret, see callResult
+ */
+static inline RET_TSL2591 releaseSync(DATA_TSL2591* driver, RET_TSL2591 ret) {
+    driver->asyncState = TSL2591_ASYNC_IDLE;
+    return callResult(driver, ret);
+}
+
+
+/**
+ * @brief busProbe - Find the fastest bus speed at which the device answers
+ *  reliably and make it the ceiling of the run time negotiation. Leaves the
+ *  slowest speed selected if none passes.
+ * @param driver - Driver Object to use
+ */
+static void busProbe(DATA_TSL2591* driver) {
+    uint8_t index, i;
+    
+    for(index = 0; index < TSL2591_BUS_SPEEDS; index++) {
+        setBusSpeed(driver, index);
+        for(i = 0; i < TSL2591_BUS_PROBE_READS; i++) {
+            driver->rxBuffer[0] = 0;
+            if((writeReadCommand(driver, TSL2591_REG_CHIPID, 1) != RET_TSL2591_SUCCESS) ||
+                    (driver->rxBuffer[0] != TSL2591_VAL_CHIPID)) {
+                break;
+            }
+        }
+        if(i == TSL2591_BUS_PROBE_READS) {
+            break;
+        }
+    }
+    if(index == TSL2591_BUS_SPEEDS) {
+        index = TSL2591_BUS_SPEEDS - 1;
+    }
+    
+    driver->busSpeedTop = index;
+    setBusSpeed(driver, index);
+    // Failed probes are expected, they are not the caller's errors
+    driver->busErrors = 0;
+    driver->busTimeouts = 0;
+    driver->i2cTimedOut = false;
+    DLOG_INFO("TSL2591 I2C bus at %lu Hz\r\n", (unsigned long)busSpeedHz[index]);
+}
+
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+// Section: Interface Functions                                               */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+
+RET_TSL2591 DRV_TSL2591_Initialize(DATA_TSL2591* instance, int intpin) {
+    uint8_t enable = TSL2591_ENABLE_READING;
+    
+    instance->i2cTransactions = 0;
+    instance->lastCallTransactions = 0;
+    instance->asyncState = TSL2591_ASYNC_IDLE;
+    instance->writesElided = 0;
+    instance->ringHead = 0;
+    instance->ringTail = 0;
+    instance->ringOverflows = 0;
+    DRV_TSL2591_ShadowInvalidate(instance);
+    DRV_TSL2591_SetAgc(instance, false);
+    instance->changeMode = false;
+    instance->oneShot = false;
+    instance->chainBatches = 0;
+    instance->chainErrors = 0;
+    instance->busStepDowns = 0;
+    instance->busStepUps = 0;
+    instance->busTimeouts = 0;
+    instance->i2cTimedOut = false;
+    instance->drvI2CHandle = DRV_I2C_Open(instance->drvIndex, DRV_IO_INTENT_READWRITE);
+    instance->interruptPin = intpin;
+    
+    if(instance->drvI2CHandle == DRV_HANDLE_INVALID) {
+        DLOG_ERROR("TSL2591 Invalid I2C Driver Handle\r\n");
+        return RET_TSL2591_INVALID_I2C;
+    }
+    else {
+        DLOG_INFO("TSL2591 Driver Init OK\r\n");
+    }
+    
+    DRV_I2C_TransferEventHandlerSet(instance->drvI2CHandle, i2cEventHandler, (uintptr_t)instance);
+    // Sample readouts go ahead of bulk traffic from other clients on the bus
+    DRV_I2C_TransferPrioritySet(instance->drvI2CHandle, DRV_I2C_TRANSFER_PRIORITY_HIGH);
+    
+    busProbe(instance);
+    writeReadCommand(instance, TSL2591_REG_CHIPID, 1);
+
+    if(instance->rxBuffer[0] == TSL2591_VAL_CHIPID) {
+        DLOG_INFO("TSL2591 ChipID Found: 0x%x\r\n", instance->rxBuffer[0]);
+    }
+    else {
+        DLOG_ERROR("TSL2591 ChipID Invalid: 0x%x\r\n", instance->rxBuffer[0]);
+        return callResult(instance, RET_TSL2591_INVALID_CHIPID);
+    }
+
+    if(applyConfig(instance, TSL2591_CONFIG_AGAIN_MID, TSL2591_CONFIG_ATIME_200MS) != RET_TSL2591_SUCCESS) {
+        return callResult(instance, RET_TSL2591_ERROR_UNKNOWN);
+    }
+    
+    if(writeRegisters(instance, TSL2591_REG_ENABLE, &enable, 1) != RET_TSL2591_SUCCESS) {
+        return callResult(instance, RET_TSL2591_ERROR_UNKNOWN);
+    }
+    
+    if(writeCommand(instance, TSL2591_CLEAR_INTERRUPTS, 1, false) != RET_TSL2591_SUCCESS) {
+        return callResult(instance, RET_TSL2591_ERROR_UNKNOWN);
+    }
+    return RET_TSL2591_SUCCESS;
+}
+
+/**
+ * @brief getRawValueClaimed - Read and decode one sample, with the instance already claimed
+ */
+static RET_TSL2591 getRawValueClaimed(DATA_TSL2591* instance) {
+    RET_TSL2591 ret;
+    uint8_t window[TSL2591_WINDOW_LEN];
+    
+    if(instance->drvI2CHandle == DRV_HANDLE_INVALID) {
+        DLOG_ERROR("TSL2591 Invalid I2C Driver Handle\r\n");
+        return RET_TSL2591_INVALID_I2C;
+    }
+    
+    // STATUS is directly followed by C0DATAL..C1DATAH, so one auto-increment
+    // burst returns the flags and both channels of the same integration cycle
+    if(writeReadCommand(instance, TSL2591_REG_STATUS, TSL2591_SAMPLE_READ_LEN) != RET_TSL2591_SUCCESS) {
+        return RET_TSL2591_ERROR_UNKNOWN;
+    }
+    
+    ret = decodeSample(instance);
+    
+    // Window re-centre and interrupt clear go out as one chain, a single
+    // wake-up of the calling task
+    stepsBegin(instance);
+    
+    if(instance->changeMode && (ret != RET_TSL2591_DATA_NOT_VALID)) {
+        buildWindow(instance, window, false);
+        stepsAddRegisters(instance, TSL2591_REG_AILTL, window, TSL2591_WINDOW_LEN);
+    }
+    
+    if(instance->oneShot && (ret != RET_TSL2591_DATA_NOT_VALID)) {
+        instance->oneShotStats.samples++;
+    }
+    
+    // In one-shot mode the pending interrupt keeps the device asleep
+    if(!instance->oneShot && (instance->status & (TSL2591_STATUS_AINT | TSL2591_STATUS_NPINTR))) {
+        stepsAddCommand(instance, TSL2591_CLEAR_INTERRUPTS);
+    }
+    
+    if(stepsRun(instance) != RET_TSL2591_SUCCESS) {
+        return RET_TSL2591_ERROR_UNKNOWN;
+    }
+    
+    return ret;
+}
+
+RET_TSL2591 DRV_TSL2591_GetRawValue(DATA_TSL2591* instance) {
+    RET_TSL2591 ret;
+    
+    if(claimSync(instance) != RET_TSL2591_SUCCESS) {
+        return RET_TSL2591_BUSY;
+    }
+    ret = getRawValueClaimed(instance);
+    return releaseSync(instance, ret);
+}
+
+RET_TSL2591 DRV_TSL2591_SetConfig(DATA_TSL2591* instance, uint8_t again, uint8_t atime) {
+    RET_TSL2591 ret;
+    
+    if(claimSync(instance) != RET_TSL2591_SUCCESS) {
+        return RET_TSL2591_BUSY;
+    }
+    ret = applyConfig(instance, again, atime);
+    return releaseSync(instance, ret);
+}
+
+RET_TSL2591 DRV_TSL2591_RegisterCallback(DATA_TSL2591* instance, TSL2591_Event_CallBack cb, void* context) {
+    if(cb == NULL) {
+        return RET_TSL2591_NULL_CALLBACK; 
+    }
+    instance->callBack = cb;
+    
+    EIC_CallbackRegister(instance->interruptPin, (EIC_CALLBACK)instance->callBack, (uintptr_t)context);
+    
+    return RET_TSL2591_SUCCESS;
+}
+
+RET_TSL2591 DRV_TSL2591_GetRawValueAsync(DATA_TSL2591* instance, TSL2591_Async_CallBack cb, uintptr_t context) {
+    DRV_I2C_TRANSFER_HANDLE transferHandle;
+    
+    if(instance->drvI2CHandle == DRV_HANDLE_INVALID) {
+        return RET_TSL2591_INVALID_I2C;
+    }
+    
+    if(cb == NULL) {
+        return RET_TSL2591_NULL_CALLBACK;
+    }
+    
+    if(startAsync(instance, TSL2591_ASYNC_SAMPLE_READ, cb, context) != RET_TSL2591_SUCCESS) {
+        return RET_TSL2591_BUSY;
+    }
+    
+    instance->txBuffer[0] = TSL2591_REG_STATUS | TSL2591_COMMAND_NORMAL_OP;
+    countTransaction(instance, TSL2591_SAMPLE_READ_LEN + 3);
+    DRV_I2C_WriteReadTransferAdd(instance->drvI2CHandle, TSL2591_I2C_ADDRESS, (void *)instance->txBuffer, 1, (void *)instance->rxBuffer, TSL2591_SAMPLE_READ_LEN, &transferHandle);
+    
+    if(transferHandle == DRV_I2C_TRANSFER_HANDLE_INVALID) {
+        instance->asyncState = TSL2591_ASYNC_IDLE;
+        return RET_TSL2591_I2C_DRIVER_ERROR;
+    }
+    
+    return RET_TSL2591_SUCCESS;
+}
+
+RET_TSL2591 DRV_TSL2591_SetConfigAsync(DATA_TSL2591* instance, uint8_t again, uint8_t atime, TSL2591_Async_CallBack cb, uintptr_t context) {
+    DRV_I2C_TRANSFER_HANDLE transferHandle;
+    uint8_t first, count;
+    
+    if(instance->drvI2CHandle == DRV_HANDLE_INVALID) {
+        return RET_TSL2591_INVALID_I2C;
+    }
+    
+    if(startAsync(instance, TSL2591_ASYNC_CONFIG, cb, context) != RET_TSL2591_SUCCESS) {
+        return RET_TSL2591_BUSY;
+    }
+    
+    instance->asyncConfig = again | atime;
+    
+    // Nothing to write: complete straight away, from the caller's context
+    if(!shadowTrim(instance, TSL2591_REG_CONFIG, &instance->asyncConfig, 1, &first, &count)) {
+        instance->writesElided++;
+        updateConfigValues(instance, again, atime);
+        finishAsync(instance, RET_TSL2591_SUCCESS);
+        return RET_TSL2591_SUCCESS;
+    }
+    
+    shadowStore(instance, TSL2591_REG_CONFIG, &instance->asyncConfig, 1, true);
+    queueShadowWrite(instance, TSL2591_REG_CONFIG, 1, &transferHandle);
+    
+    if(transferHandle == DRV_I2C_TRANSFER_HANDLE_INVALID) {
+        shadowStore(instance, TSL2591_REG_CONFIG, NULL, 1, false);
+        instance->asyncState = TSL2591_ASYNC_IDLE;
+        return RET_TSL2591_I2C_DRIVER_ERROR;
+    }
+    
+    return RET_TSL2591_SUCCESS;
+}
+
+RET_TSL2591 DRV_TSL2591_ComputeMilliLux(uint8_t config, uint16_t ch0, uint16_t ch1, uint32_t* milliLux) {
+    uint8_t atime = config & TSL2591_CONFIG_ATIME_MASK;
+    uint16_t fullScale = maxCount(atime);
+    
+    if(atime > TSL2591_CONFIG_ATIME_600MS) {
+        atime = TSL2591_CONFIG_ATIME_600MS;
+    }
+    
+    if((ch0 >= fullScale) || (ch1 >= fullScale)) {
+        *milliLux = TSL2591_MILLILUX_SATURATED;
+        return RET_TSL2591_SATURATED;
+    }
+    
+    *milliLux = DRV_TSL2591_LuxFromCounts((config & TSL2591_CONFIG_AGAIN_MASK) >> 4, atime, ch0, ch1);
+    
+    return RET_TSL2591_SUCCESS;
+}
+
+RET_TSL2591 DRV_TSL2591_SetAgc(DATA_TSL2591* instance, bool enable) {
+    instance->agcEnabled = enable;
+    instance->agcAdjusting = false;
+    instance->agcCycles = 0;
+    instance->agcLastCycles = 0;
+    
+    return RET_TSL2591_SUCCESS;
+}
+
+/**
+ * @brief agcUpdateClaimed - Run one AGC step, with the instance already claimed
+ */
+static RET_TSL2591 agcUpdateClaimed(DATA_TSL2591* instance, RET_TSL2591 sampleResult) {
+    uint8_t config;
+    uint8_t restart[2];
+    uint8_t enable;
+    uint8_t window[TSL2591_WINDOW_LEN];
+    
+    config = agcSelectConfig(instance->config, (instance->ch0 > instance->ch1) ? instance->ch0 : instance->ch1, sampleResult == RET_TSL2591_SATURATED);
+    
+    if(instance->agcAdjusting) {
+        instance->agcCycles++;
+    }
+    
+    if(config == instance->config) {
+        // In band, or pinned at the end of the range
+        if(instance->agcAdjusting) {
+            instance->agcAdjusting = false;
+            instance->agcLastCycles = instance->agcCycles;
+        }
+        return sampleResult;
+    }
+    
+    if(!instance->agcAdjusting) {
+        instance->agcAdjusting = true;
+        instance->agcCycles = 1;
+    }
+    
+    // A one-shot integration only starts on the next trigger, so there is
+    // nothing to restart
+    if(instance->oneShot) {
+        if(applyConfig(instance, config & TSL2591_CONFIG_AGAIN_MASK, config & TSL2591_CONFIG_ATIME_MASK) != RET_TSL2591_SUCCESS) {
+            return RET_TSL2591_ERROR_UNKNOWN;
+        }
+        return RET_TSL2591_AGC_ADJUSTING;
+    }
+    
+    // Clear AEN together with the new CONFIG, then set it again: the next
+    // interrupt is then a full integration at the new setting rather than
+    // a cycle that straddled the change. The writes go out as one chain.
+    if(readShadow(instance, TSL2591_REG_ENABLE, &enable) != RET_TSL2591_SUCCESS) {
+        return RET_TSL2591_ERROR_UNKNOWN;
+    }
+    stepsBegin(instance);
+    restart[0] = enable & ~TSL2591_ENABLE_AEN;
+    restart[1] = config;
+    stepsAddRegisters(instance, TSL2591_REG_ENABLE, restart, sizeof(restart));
+    
+    // The window is in counts of the old setting; make sure the first
+    // reading at the new one is reported so it can be re-centred
+    if(instance->changeMode) {
+        buildWindow(instance, window, true);
+        stepsAddRegisters(instance, TSL2591_REG_AILTL, window, TSL2591_WINDOW_LEN);
+    }
+    
+    stepsAddRegisters(instance, TSL2591_REG_ENABLE, &enable, 1);
+    
+    if(stepsRun(instance) != RET_TSL2591_SUCCESS) {
+        return RET_TSL2591_ERROR_UNKNOWN;
+    }
+    updateConfigValues(instance, config & TSL2591_CONFIG_AGAIN_MASK, config & TSL2591_CONFIG_ATIME_MASK);
+    
+    return RET_TSL2591_AGC_ADJUSTING;
+}
+
+RET_TSL2591 DRV_TSL2591_AgcUpdate(DATA_TSL2591* instance, RET_TSL2591 sampleResult) {
+    RET_TSL2591 ret;
+    
+    if(!instance->agcEnabled || ((sampleResult != RET_TSL2591_SUCCESS) && (sampleResult != RET_TSL2591_SATURATED))) {
+        return sampleResult;
+    }
+    
+    if(claimSync(instance) != RET_TSL2591_SUCCESS) {
+        return RET_TSL2591_BUSY;
+    }
+    ret = agcUpdateClaimed(instance, sampleResult);
+    return releaseSync(instance, ret);
+}
+
+uint8_t DRV_TSL2591_GetAgcCycles(DATA_TSL2591* instance) {
+    uint8_t cycles = instance->agcLastCycles;
+    
+    instance->agcLastCycles = 0;
+    
+    return cycles;
+}
+
+/**
+ * @brief setChangeModeClaimed - Program report-on-change mode, with the instance already claimed
+ */
+static RET_TSL2591 setChangeModeClaimed(DATA_TSL2591* instance, bool enable, uint8_t windowPercent, uint8_t persist) {
+    uint8_t window[TSL2591_WINDOW_LEN];
+    
+    if(instance->drvI2CHandle == DRV_HANDLE_INVALID) {
+        return RET_TSL2591_INVALID_I2C;
+    }
+    
+    if(!enable) {
+        persist = TSL2591_PERSIST_EVERY;
+    }
+    
+    if(writeRegisters(instance, TSL2591_REG_PERSIST, &persist, 1) != RET_TSL2591_SUCCESS) {
+        return RET_TSL2591_ERROR_UNKNOWN;
+    }
+    
+    instance->changeWindowPercent = windowPercent;
+    instance->changeMode = enable;
+    
+    if(enable) {
+        buildWindow(instance, window, false);
+        if(writeRegisters(instance, TSL2591_REG_AILTL, window, TSL2591_WINDOW_LEN) != RET_TSL2591_SUCCESS) {
+            return RET_TSL2591_ERROR_UNKNOWN;
+        }
+    }
+    
+    return RET_TSL2591_SUCCESS;
+}
+
+RET_TSL2591 DRV_TSL2591_SetChangeMode(DATA_TSL2591* instance, bool enable, uint8_t windowPercent, uint8_t persist) {
+    RET_TSL2591 ret;
+    
+    if(claimSync(instance) != RET_TSL2591_SUCCESS) {
+        return RET_TSL2591_BUSY;
+    }
+    ret = setChangeModeClaimed(instance, enable, windowPercent, persist);
+    return releaseSync(instance, ret);
+}
+
+/**
+ * @brief setNoPersistThresholdsClaimed - Arm or disarm the no-persist thresholds, with the instance already claimed
+ */
+static RET_TSL2591 setNoPersistThresholdsClaimed(DATA_TSL2591* instance, bool enable, uint16_t low, uint16_t high) {
+    uint8_t window[TSL2591_WINDOW_LEN];
+    
+    if(instance->drvI2CHandle == DRV_HANDLE_INVALID) {
+        return RET_TSL2591_INVALID_I2C;
+    }
+    
+    if(enable) {
+        window[0] = low & 0xFF;
+        window[1] = low >> 8;
+        window[2] = high & 0xFF;
+        window[3] = high >> 8;
+        if(writeRegisters(instance, TSL2591_REG_NPAILTL, window, TSL2591_WINDOW_LEN) != RET_TSL2591_SUCCESS) {
+            return RET_TSL2591_ERROR_UNKNOWN;
+        }
+    }
+    
+    if(updateRegisterBits(instance, TSL2591_REG_ENABLE, TSL2591_ENABLE_NPIEN, enable ? TSL2591_ENABLE_NPIEN : 0) != RET_TSL2591_SUCCESS) {
+        return RET_TSL2591_ERROR_UNKNOWN;
+    }
+    
+    return RET_TSL2591_SUCCESS;
+}
+
+RET_TSL2591 DRV_TSL2591_SetNoPersistThresholds(DATA_TSL2591* instance, bool enable, uint16_t low, uint16_t high) {
+    RET_TSL2591 ret;
+    
+    if(claimSync(instance) != RET_TSL2591_SUCCESS) {
+        return RET_TSL2591_BUSY;
+    }
+    ret = setNoPersistThresholdsClaimed(instance, enable, low, high);
+    return releaseSync(instance, ret);
+}
+
+TSL2591_INT_CLASS DRV_TSL2591_GetInterruptClass(DATA_TSL2591* instance) {
+    TSL2591_INT_CLASS intClass = TSL2591_INT_NONE;
+    
+    if(instance->status & TSL2591_STATUS_AINT) {
+        intClass |= TSL2591_INT_ALS;
+    }
+    if(instance->status & TSL2591_STATUS_NPINTR) {
+        intClass |= TSL2591_INT_NO_PERSIST;
+    }
+    
+    return intClass;
+}
+
+/**
+ * @brief setOneShotModeClaimed - Enter or leave one-shot mode, with the instance already claimed
+ */
+static RET_TSL2591 setOneShotModeClaimed(DATA_TSL2591* instance, bool enable) {
+    RET_TSL2591 ret;
+    
+    if(instance->drvI2CHandle == DRV_HANDLE_INVALID) {
+        return RET_TSL2591_INVALID_I2C;
+    }
+    
+    if(enable == instance->oneShot) {
+        return RET_TSL2591_SUCCESS;
+    }
+    
+    // Every completed cycle has to raise AINT, or SAI never puts the device
+    // back to sleep
+    ret = setChangeModeClaimed(instance, false, 0, TSL2591_PERSIST_EVERY);
+    if(ret != RET_TSL2591_SUCCESS) {
+        return ret;
+    }
+    
+    if(enable) {
+        ret = updateRegisterBits(instance, TSL2591_REG_ENABLE, TSL2591_ENABLE_PON | TSL2591_ENABLE_AEN, TSL2591_ENABLE_SAI);
+    }
+    else {
+        ret = updateRegisterBits(instance, TSL2591_REG_ENABLE, TSL2591_ENABLE_SAI, TSL2591_ENABLE_PON | TSL2591_ENABLE_AEN);
+    }
+    if(ret != RET_TSL2591_SUCCESS) {
+        return RET_TSL2591_ERROR_UNKNOWN;
+    }
+    
+    // Drop any interrupt left over from continuous sampling; on the way
+    // out this also wakes the device from SAI sleep
+    if(writeCommand(instance, TSL2591_CLEAR_INTERRUPTS, 1, false) != RET_TSL2591_SUCCESS) {
+        return RET_TSL2591_ERROR_UNKNOWN;
+    }
+    
+    instance->oneShot = enable;
+    instance->oneShotPoweredDown = true;
+    memset(&instance->oneShotStats, 0, sizeof(instance->oneShotStats));
+    instance->oneShotTransactionBase = instance->i2cTransactions;
+    
+    return RET_TSL2591_SUCCESS;
+}
+
+RET_TSL2591 DRV_TSL2591_SetOneShotMode(DATA_TSL2591* instance, bool enable) {
+    RET_TSL2591 ret;
+    
+    if(claimSync(instance) != RET_TSL2591_SUCCESS) {
+        return RET_TSL2591_BUSY;
+    }
+    ret = setOneShotModeClaimed(instance, enable);
+    return releaseSync(instance, ret);
+}
+
+/**
+ * @brief triggerOneShotClaimed - Start one one-shot integration, with the instance already claimed
+ */
+static RET_TSL2591 triggerOneShotClaimed(DATA_TSL2591* instance) {
+    if(!instance->oneShot) {
+        return RET_TSL2591_ERROR_UNKNOWN;
+    }
+    
+    if(instance->oneShotPoweredDown) {
+        if(updateRegisterBits(instance, TSL2591_REG_ENABLE, 0, TSL2591_ENABLE_PON | TSL2591_ENABLE_AEN) != RET_TSL2591_SUCCESS) {
+            return RET_TSL2591_ERROR_UNKNOWN;
+        }
+        instance->oneShotPoweredDown = false;
+    }
+    else {
+        if(writeCommand(instance, TSL2591_CLEAR_INTERRUPTS, 1, false) != RET_TSL2591_SUCCESS) {
+            return RET_TSL2591_ERROR_UNKNOWN;
+        }
+    }
+    
+    instance->oneShotStats.integrations++;
+    instance->oneShotStats.poweredMs += 100 * ((instance->config & TSL2591_CONFIG_ATIME_MASK) + 1);
+    
+    return RET_TSL2591_SUCCESS;
+}
+
+RET_TSL2591 DRV_TSL2591_TriggerOneShot(DATA_TSL2591* instance) {
+    RET_TSL2591 ret;
+    
+    if(claimSync(instance) != RET_TSL2591_SUCCESS) {
+        return RET_TSL2591_BUSY;
+    }
+    ret = triggerOneShotClaimed(instance);
+    return releaseSync(instance, ret);
+}
+
+RET_TSL2591 DRV_TSL2591_GetOneShotStats(DATA_TSL2591* instance, TSL2591_ONESHOT_STATS* stats) {
+    *stats = instance->oneShotStats;
+    stats->i2cTransactions = instance->i2cTransactions - instance->oneShotTransactionBase;
+    
+    return RET_TSL2591_SUCCESS;
+}
+
+RET_TSL2591 DRV_TSL2591_ShadowInvalidate(DATA_TSL2591* instance) {
+    instance->shadowValid = 0;
+    
+    return RET_TSL2591_SUCCESS;
+}
+
+/**
+ * @brief shadowResyncClaimed - Reload the register shadow, with the instance already claimed
+ */
+static RET_TSL2591 shadowResyncClaimed(DATA_TSL2591* instance) {
+    uint8_t config;
+    
+    if(instance->drvI2CHandle == DRV_HANDLE_INVALID) {
+        return RET_TSL2591_INVALID_I2C;
+    }
+    
+    instance->lastCallTransactions = 0;
+    instance->shadowValid = 0;
+    
+    if(writeReadCommand(instance, TSL2591_REG_ENABLE, TSL2591_SHADOW_SIZE) != RET_TSL2591_SUCCESS) {
+        return RET_TSL2591_I2C_DRIVER_ERROR;
+    }
+    shadowStore(instance, TSL2591_REG_ENABLE, (uint8_t*)instance->rxBuffer, TSL2591_SHADOW_SIZE, true);
+    
+    config = instance->shadow[TSL2591_REG_CONFIG];
+    updateConfigValues(instance, config & TSL2591_CONFIG_AGAIN_MASK, config & TSL2591_CONFIG_ATIME_MASK);
+    
+    return RET_TSL2591_SUCCESS;
+}
+
+RET_TSL2591 DRV_TSL2591_ShadowResync(DATA_TSL2591* instance) {
+    RET_TSL2591 ret;
+    
+    if(claimSync(instance) != RET_TSL2591_SUCCESS) {
+        return RET_TSL2591_BUSY;
+    }
+    ret = shadowResyncClaimed(instance);
+    return releaseSync(instance, ret);
+}
+
+uint32_t DRV_TSL2591_RingDrain(DATA_TSL2591* instance, TSL2591_SAMPLE* samples, uint32_t maxSamples) {
+    uint32_t tail = instance->ringTail;
+    uint32_t count = instance->ringHead - tail;
+    uint32_t i;
+    
+    if(count > maxSamples) {
+        count = maxSamples;
+    }
+    
+    // Read the records only after the head that published them
+    __DMB();
+    for(i = 0; i < count; i++) {
+        samples[i] = instance->ring[(tail + i) & (TSL2591_RING_SIZE - 1)];
+    }
+    
+    // Done with the slots before handing them back to the producer
+    __DMB();
+    instance->ringTail = tail + count;
+    
+    return count;
+}
+
+uint32_t DRV_TSL2591_RingCount(DATA_TSL2591* instance) {
+    return instance->ringHead - instance->ringTail;
+}
+
+RET_TSL2591 DRV_TSL2591_ChainStart(DATA_TSL2591* instance, TSL2591_Async_CallBack cb, uintptr_t context) {
+    sercom_i2cm_registers_t* regs = DRV_TSL2591_CHAIN_I2C_REGS;
+    
+    if(instance->drvI2CHandle == DRV_HANDLE_INVALID) {
+        return RET_TSL2591_INVALID_I2C;
+    }
+    
+    if(claimSync(instance) != RET_TSL2591_SUCCESS) {
+        return RET_TSL2591_BUSY;
+    }
+    
+    if(instance->oneShot) {
+        return releaseSync(instance, RET_TSL2591_ERROR_UNKNOWN);
+    }
+    
+    // From here on the sensor interrupt only feeds the event system
+    EIC_InterruptDisable((EIC_PIN)instance->interruptPin);
+    
+    // Start from a released INT line, so the first edge is a fresh cycle
+    if(writeCommand(instance, TSL2591_CLEAR_INTERRUPTS, 1, false) != RET_TSL2591_SUCCESS) {
+        EIC_InterruptEnable((EIC_PIN)instance->interruptPin);
+        return releaseSync(instance, RET_TSL2591_I2C_DRIVER_ERROR);
+    }
+    
+    // Hold the other clients' transfers and wait out the one on the bus, the
+    // driver's timeout handling must not re-initialize SERCOM3 under the chain
+    if(!DRV_I2C_BusAcquire(instance->drvI2CHandle, TSL2591_CHAIN_ACQUIRE_MS)) {
+        EIC_InterruptEnable((EIC_PIN)instance->interruptPin);
+        return releaseSync(instance, RET_TSL2591_BUSY);
+    }
+    
+    chainBuild();
+    instance->chainHalf = 0;
+    instance->asyncCallBack = cb;
+    instance->asyncContext = context;
+    instance->asyncState = TSL2591_ASYNC_CHAIN;
+    DMAC_ChannelCallbackRegister(DRV_TSL2591_CHAIN_RX_CHANNEL, chainEventHandler, (uintptr_t)instance);
+    
+    // MB and SB now trigger the DMAC only; the I2C driver is held off
+    regs->SERCOM_INTENCLR = SERCOM_I2CM_INTENCLR_Msk;
+    regs->SERCOM_INTFLAG = SERCOM_I2CM_INTFLAG_Msk;
+    
+    // Head last, so every later channel is armed before the first event
+    DMAC_ChannelLinkedListTransfer(DRV_TSL2591_CHAIN_RX_CHANNEL, &chainRxDesc[0]);
+    DMAC_ChannelLinkedListTransfer(DRV_TSL2591_CHAIN_TX_CHANNEL, &chainTxDesc[0]);
+    DMAC_ChannelLinkedListTransfer(DRV_TSL2591_CHAIN_HEAD_CHANNEL, &chainHeadDesc);
+    
+    // An edge between the clear and now has been missed, start that cycle by hand
+    if((EIC_REGS->EIC_PINSTATE & (1UL << instance->interruptPin)) == 0U) {
+        DMAC_ChannelSoftwareTrigger(DRV_TSL2591_CHAIN_HEAD_CHANNEL);
+    }
+    
+    return RET_TSL2591_SUCCESS;
+}
+
+RET_TSL2591 DRV_TSL2591_ChainStop(DATA_TSL2591* instance) {
+    sercom_i2cm_registers_t* regs = DRV_TSL2591_CHAIN_I2C_REGS;
+    TickType_t start;
+    bool drained;
+    RET_TSL2591 ret;
+    
+    if(instance->asyncState != TSL2591_ASYNC_CHAIN) {
+        return RET_TSL2591_SUCCESS;
+    }
+    
+    // No new readouts, then let the one on the bus run to its end
+    DMAC_ChannelDisable(DRV_TSL2591_CHAIN_HEAD_CHANNEL);
+    start = xTaskGetTickCount();
+    while(!(drained = chainDrained())) {
+        if((xTaskGetTickCount() - start) >= pdMS_TO_TICKS(TSL2591_CHAIN_DRAIN_MS)) {
+            break;
+        }
+        vTaskDelay(1);
+    }
+    DMAC_ChannelDisable(DRV_TSL2591_CHAIN_TX_CHANNEL);
+    DMAC_ChannelDisable(DRV_TSL2591_CHAIN_RX_CHANNEL);
+    
+    // A readout stuck on the bus, NACK any byte in flight and STOP
+    if(!drained) {
+        instance->chainErrors++;
+        if((regs->SERCOM_STATUS & SERCOM_I2CM_STATUS_BUSSTATE_Msk) == SERCOM_I2CM_STATUS_BUSSTATE(2U)) {
+            regs->SERCOM_CTRLB |= SERCOM_I2CM_CTRLB_ACKACT_Msk | SERCOM_I2CM_CTRLB_CMD(3U);
+            while((regs->SERCOM_SYNCBUSY & SERCOM_I2CM_SYNCBUSY_SYSOP_Msk) != 0U) {
+                /* Wait for the STOP to be issued */
+            }
+        }
+    }
+    
+    regs->SERCOM_INTFLAG = SERCOM_I2CM_INTFLAG_Msk;
+    regs->SERCOM_INTENSET = SERCOM_I2CM_INTENSET_Msk;
+    DRV_I2C_BusRelease(instance->drvI2CHandle);
+    
+    // Back to a blocking claim for the clear below
+    instance->asyncCallBack = NULL;
+    instance->asyncState = TSL2591_ASYNC_SYNC;
+    instance->i2cTimedOut = false;
+    
+    // The sensor may be holding INT low for a cycle nobody will read
+    ret = writeCommand(instance, TSL2591_CLEAR_INTERRUPTS, 1, false);
+    EIC_InterruptEnable((EIC_PIN)instance->interruptPin);
+    
+    if(ret != RET_TSL2591_SUCCESS) {
+        ret = RET_TSL2591_I2C_DRIVER_ERROR;
+    }
+    else if(!drained) {
+        ret = RET_TSL2591_I2C_TIMEOUT;
+    }
+    return releaseSync(instance, ret);
+}
+
+RET_TSL2591 DRV_TSL2591_GetBusStats(DATA_TSL2591* instance, TSL2591_BUS_STATS* stats) {
+    bool intState;
+    uint32_t bytes;
+    uint64_t cycles;
+    
+    // The counters move in the I2C interrupt, take them as one snapshot
+    intState = SYS_INT_Disable();
+    stats->speedHz = busSpeedHz[instance->busSpeedIndex];
+    stats->speedMaxHz = busSpeedHz[instance->busSpeedTop];
+    stats->errors = instance->busErrors;
+    stats->timeouts = instance->busTimeouts;
+    stats->stepDowns = instance->busStepDowns;
+    stats->stepUps = instance->busStepUps;
+    bytes = instance->busBytes;
+    cycles = instance->busCycles;
+    SYS_INT_Restore(intState);
+    
+    stats->bytesPerSecond = (cycles != 0) ? (uint32_t)(((uint64_t)bytes * CPU_CLOCK_FREQUENCY) / cycles) : 0;
+    
+    return RET_TSL2591_SUCCESS;
+}
+
+uint8_t DRV_TSL2591_GetLastTransactionCount(DATA_TSL2591* instance) {
+    return instance->lastCallTransactions;
+}
+
 
 /* *****************************************************************************
  End of File
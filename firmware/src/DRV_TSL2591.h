@@ -33,14 +33,45 @@ extern "C" {
 #include <stdbool.h>
 #include <stddef.h>
 #include <stdlib.h>
+#include <limits.h>
 #include "configuration.h"
+#include "driver/i2c/drv_i2c.h"
     
 /* ************************************************************************** */
 /* ************************************************************************** */
 /* Section: Constants                                                         */
 /* ************************************************************************** */
 /* ************************************************************************** */
-#define TSL2591_RXBUFFER_SIZE             10
+#define TSL2591_RXBUFFER_SIZE             13
+#define TSL2591_TXBUFFER_SIZE             13
+#define TSL2591_SHADOW_SIZE               13      // Registers ENABLE (0x00) .. PERSIST (0x0C)
+#define TSL2591_TX_STEPS                  3       // Transactions of one I2C driver chain, staged in txBuffer
+
+/**
+ * @brief Number of samples held by each instance's sample ring. Must be a
+ *  power of two; may be overridden from configuration.h.
+ */
+#ifndef TSL2591_RING_SIZE
+#define TSL2591_RING_SIZE                 16
+#endif
+
+/**
+ * @brief Number of samples per batch of the hardware acquisition chain
+ *  (DRV_TSL2591_ChainStart); the CPU is interrupted once per batch. May be
+ *  overridden from configuration.h.
+ */
+#ifndef TSL2591_CHAIN_BATCH
+#define TSL2591_CHAIN_BATCH               8
+#endif
+
+/**
+ * @brief Fastest I2C clock, in Hz, tried by the bus speed negotiation at
+ *  DRV_TSL2591_Initialize (the device supports 400 kHz fast mode). May be
+ *  overridden from configuration.h.
+ */
+#ifndef TSL2591_I2C_SPEED_MAX
+#define TSL2591_I2C_SPEED_MAX             400000
+#endif
 
 /**
  * @brief TSL2591 config register setting.
@@ -60,6 +91,44 @@ extern "C" {
 #define TSL2591_CONFIG_ATIME_600MS        0x05
 #define TSL2591_CONFIG_ATIME_MASK         0x07
 
+/**
+ * @brief TSL2591 status register bits.
+ * @details Reported in DATA_TSL2591.status after each sample read.
+ */
+#define TSL2591_STATUS_AVALID             0x01
+#define TSL2591_STATUS_AINT               0x10
+#define TSL2591_STATUS_NPINTR             0x20
+
+/**
+ * @brief TSL2591 persist register setting.
+ * @details Number of consecutive out-of-window ALS cycles required before
+ *  AINT is asserted.
+ */
+#define TSL2591_PERSIST_EVERY             0x00
+#define TSL2591_PERSIST_ANY               0x01
+#define TSL2591_PERSIST_2                 0x02
+#define TSL2591_PERSIST_3                 0x03
+#define TSL2591_PERSIST_5                 0x04
+#define TSL2591_PERSIST_10                0x05
+#define TSL2591_PERSIST_15                0x06
+#define TSL2591_PERSIST_20                0x07
+#define TSL2591_PERSIST_25                0x08
+#define TSL2591_PERSIST_30                0x09
+#define TSL2591_PERSIST_35                0x0A
+#define TSL2591_PERSIST_40                0x0B
+#define TSL2591_PERSIST_45                0x0C
+#define TSL2591_PERSIST_50                0x0D
+#define TSL2591_PERSIST_55                0x0E
+#define TSL2591_PERSIST_60                0x0F
+
+/**
+ * @brief Reported in DATA_TSL2591.milliLux and lux when either channel is
+ *  saturated: the light is above what the current config can measure, so
+ *  both clamp to their largest value instead of keeping the last reading.
+ */
+#define TSL2591_MILLILUX_SATURATED        0xFFFFFFFFUL
+#define TSL2591_LUX_SATURATED             INT_MAX
+
     
 // *****************************************************************************
 // *****************************************************************************
@@ -68,7 +137,90 @@ extern "C" {
 // *****************************************************************************
 typedef void (*TSL2591_Event_CallBack)(uintptr_t context);
 
+typedef enum {
+    RET_TSL2591_SUCCESS = 0,
+    RET_TSL2591_INVALID_I2C,
+    RET_TSL2591_INVALID_CHIPID,
+    RET_TSL2591_I2C_DRIVER_ERROR,
+    RET_TSL2591_NULL_CALLBACK,
+    RET_TSL2591_INVALID_LENGTH,
+    RET_TSL2591_DATA_NOT_VALID,
+    RET_TSL2591_BUSY,
+    RET_TSL2591_SATURATED,
+    RET_TSL2591_AGC_ADJUSTING,
+    RET_TSL2591_I2C_TIMEOUT,
+    RET_TSL2591_ERROR_UNKNOWN
+}RET_TSL2591;
+
+struct _DATA_TSL2591;
+
+/**
+ * @brief Completion callback for the asynchronous API. Called from the I2C
+ *  interrupt context once the requested operation has finished, or from task
+ *  context when the I2C driver retires the transfer on its timeout, so
+ *  FreeRTOS calls have to pick their FromISR form by __get_IPSR(). For samples,
+ *  the decoded values are in instance->status/ch0/ch1/lux. On
+ *  RET_TSL2591_SATURATED, lux and milliLux hold TSL2591_LUX_SATURATED and
+ *  TSL2591_MILLILUX_SATURATED.
+ */
+typedef void (*TSL2591_Async_CallBack)(struct _DATA_TSL2591* instance, RET_TSL2591 result, uintptr_t context);
+
+/**
+ * @brief Interrupt classes, decoded from the STATUS byte of a sample read.
+ *  Both bits may be set when the two channels tripped in the same cycle.
+ */
+typedef enum {
+    TSL2591_INT_NONE = 0,
+    TSL2591_INT_ALS = 0x01,             // Persisted ALS threshold (AINT)
+    TSL2591_INT_NO_PERSIST = 0x02       // No-persist threshold (NPINTR)
+}TSL2591_INT_CLASS;
+
+/**
+ * @brief One record of the sample ring. Carries the CONFIG value the
+ *  counts were taken with, so it can be converted with
+ *  DRV_TSL2591_ComputeMilliLux independently of later gain changes.
+ */
+typedef struct {
+    uint32_t tick;                      // RTOS tick count when the sample was read
+    uint16_t ch0;
+    uint16_t ch1;
+    uint8_t config;
+    uint8_t status;
+}TSL2591_SAMPLE;
+
+/**
+ * @brief One-shot (sleep after interrupt) acquisition statistics.
+ */
 typedef struct {
+    uint32_t samples;                   // One-shot readings completed
+    uint32_t integrations;              // Integration cycles triggered
+    uint32_t poweredMs;                 // Time the ADC was powered, from the integration times used
+    uint32_t i2cTransactions;           // Bus transactions since one-shot mode was entered
+}TSL2591_ONESHOT_STATS;
+
+/**
+ * @brief I2C bus speed negotiation statistics.
+ */
+typedef struct {
+    uint32_t speedHz;                   // SCL frequency in use
+    uint32_t speedMaxHz;                // Fastest speed that passed the probe at init
+    uint32_t bytesPerSecond;            // Bytes on the wire per second of transfer time at speedHz
+    uint32_t errors;                    // Transfers that failed on the bus since init
+    uint32_t timeouts;                  // Transfers aborted by the I2C driver timeout since init
+    uint32_t stepDowns;                 // Speed reductions after an error burst
+    uint32_t stepUps;                   // Speed increases after a clean run
+}TSL2591_BUS_STATS;
+
+typedef enum {
+    TSL2591_ASYNC_IDLE = 0,
+    TSL2591_ASYNC_SAMPLE_READ,
+    TSL2591_ASYNC_SAMPLE_UPDATE,        // Window re-centre and/or interrupt clear, as one chain
+    TSL2591_ASYNC_CONFIG,
+    TSL2591_ASYNC_SYNC,                 // Claimed by a blocking call
+    TSL2591_ASYNC_CHAIN                 // Owned by the hardware acquisition chain
+}TSL2591_ASYNC_STATE;
+
+typedef struct _DATA_TSL2591 {
    DRV_HANDLE drvI2CHandle;
    TSL2591_Event_CallBack callBack;
    SYS_MODULE_INDEX drvIndex;
@@ -76,19 +228,62 @@ typedef struct {
    float atime_ms;
    float again;
    float cpl;
-   int lux;
+   int lux;                         // TSL2591_LUX_SATURATED when saturated
+   uint32_t milliLux;               // TSL2591_MILLILUX_SATURATED when saturated
+   uint8_t config;                  // Current CONFIG register value (again | atime)
+   uint8_t shadow[TSL2591_SHADOW_SIZE];     // Last value written to / read from each register
+   uint16_t shadowValid;                    // Bit n set: shadow[n] matches the device
+   uint32_t writesElided;                   // Register writes skipped because nothing changed
+   TSL2591_SAMPLE ring[TSL2591_RING_SIZE];
+   volatile uint32_t ringHead;              // Free running, written by the sample read path only
+   volatile uint32_t ringTail;              // Free running, written by DRV_TSL2591_RingDrain only
+   uint32_t ringOverflows;                  // Samples dropped because the ring was full
+   uint8_t status;
+   uint16_t ch0;
+   uint16_t ch1;
    char rxBuffer[TSL2591_RXBUFFER_SIZE];
+   uint8_t txBuffer[TSL2591_TXBUFFER_SIZE];
+   DRV_I2C_SEGMENT txSegments[2];   // Command byte + payload of a queued register write
+   DRV_I2C_CHAIN_TRANSFER txSteps[TSL2591_TX_STEPS];   // Staged I2C driver chain
+   uint8_t txStepCount;             // Transactions staged in txSteps
+   uint8_t txUsed;                  // txBuffer bytes taken by the staged transactions
+   uint8_t txStepBytes;             // Bytes on the wire of the staged transactions
+   uint32_t i2cTransactions;        // Total I2C transactions issued by this instance
+   uint8_t lastCallTransactions;    // I2C transactions issued by the most recent public call
+   volatile TSL2591_ASYNC_STATE asyncState;
+   TSL2591_Async_CallBack asyncCallBack;
+   uintptr_t asyncContext;
+   RET_TSL2591 asyncResult;
+   uint8_t asyncConfig;             // CONFIG value being written by DRV_TSL2591_SetConfigAsync
+   bool agcEnabled;
+   bool agcAdjusting;               // An out-of-band reading has been seen and not yet settled
+   uint8_t agcCycles;               // Integration cycles spent on the current adjustment
+   uint8_t agcLastCycles;           // Cycles taken by the last completed adjustment, 0 once read
+   bool changeMode;                 // Report-on-change: AINT only fires when ch0 leaves the window
+   uint8_t changeWindowPercent;     // Half-width of the window around the last ch0
+   bool oneShot;                    // SAI mode: one integration per DRV_TSL2591_TriggerOneShot
+   bool oneShotPoweredDown;         // Device is off (PON clear) rather than asleep after an interrupt
+   TSL2591_ONESHOT_STATS oneShotStats;
+   uint32_t oneShotTransactionBase; // i2cTransactions when one-shot mode was entered
+   uint8_t chainHalf;               // Half of the chain's receive buffer being filled next
+   uint32_t chainBatches;           // Batches delivered by the hardware acquisition chain
+   uint32_t chainErrors;            // DMAC errors seen by the hardware acquisition chain
+   uint8_t busSpeedIndex;           // Bus speed in use, index into the negotiation table
+   uint8_t busSpeedTop;             // Fastest speed found by the probe at init
+   uint8_t busWindowCount;          // Transfers in the current error counting window
+   uint8_t busWindowErrors;         // Bus errors in the current error counting window
+   uint8_t busCleanWindows;         // Consecutive windows without a bus error
+   uint8_t busPendingBytes;         // Bytes on the wire of the transfer in flight
+   uint32_t busStartCycles;         // DWT cycle count when the transfer in flight was issued
+   uint32_t busBytes;               // Bytes transferred at the current speed
+   uint64_t busCycles;              // Transfer time at the current speed, in CPU cycles
+   uint32_t busErrors;
+   uint32_t busTimeouts;            // Transfers aborted by the I2C driver timeout
+   bool i2cTimedOut;                // A transfer of the current call timed out
+   uint32_t busStepDowns;
+   uint32_t busStepUps;
 } DATA_TSL2591;
 
-typedef enum {
-    RET_TSL2591_SUCCESS = 0,
-    RET_TSL2591_INVALID_I2C,
-    RET_TSL2591_INVALID_CHIPID,
-    RET_TSL2591_I2C_DRIVER_ERROR,
-    RET_TSL2591_NULL_CALLBACK,
-    RET_TSL2591_ERROR_UNKNOWN
-}RET_TSL2591;
-
 // *****************************************************************************
 // *****************************************************************************
 // Section: Interface Functions
@@ -115,7 +310,12 @@ RET_TSL2591 DRV_TSL2591_Initialize(DATA_TSL2591* instance, int intpin);
  * 
  * @Summary
  *  Get a value from the TSL2591 pin and return it in the 
- *  provided DATA_TSL2591 object
+ *  provided DATA_TSL2591 object. STATUS, CH0 and CH1 are read in a single
+ *  burst; RET_TSL2591_DATA_NOT_VALID is returned (and ch0/ch1/lux are left
+ *  untouched) if no integration cycle has completed yet, and
+ *  RET_TSL2591_SATURATED if the sensor is saturated at the current config
+ *  (lux and milliLux then hold TSL2591_LUX_SATURATED and
+ *  TSL2591_MILLILUX_SATURATED).
  * 
  * @param instance - DATA_TSL2591 object to use
  * 
@@ -150,6 +350,332 @@ RET_TSL2591 DRV_TSL2591_SetConfig(DATA_TSL2591* instance, uint8_t again, uint8_t
  */
 RET_TSL2591 DRV_TSL2591_RegisterCallback(DATA_TSL2591* instance, TSL2591_Event_CallBack cb, void* context);
 
+/** 
+ * @Function
+ *  RET_TSL2591 DRV_TSL2591_GetRawValueAsync ( DATA_TSL2591* instance, TSL2591_Async_CallBack cb, uintptr_t context ) 
+ * 
+ * @Summary
+ *  Queue a sample readout and return immediately. The decoded sample is
+ *  delivered through cb from the I2C completion path. Returns
+ *  RET_TSL2591_BUSY if another asynchronous operation is still pending.
+ * 
+ * @param instance - DATA_TSL2591 object to use
+ * @param cb - Callback to trigger when the sample is available
+ * @param context - User Data to be delivered back through the callback
+ * 
+ */
+RET_TSL2591 DRV_TSL2591_GetRawValueAsync(DATA_TSL2591* instance, TSL2591_Async_CallBack cb, uintptr_t context);
+
+/** 
+ * @Function
+ *  RET_TSL2591 DRV_TSL2591_SetConfigAsync ( DATA_TSL2591* instance, uint8_t again, uint8_t atime, TSL2591_Async_CallBack cb, uintptr_t context ) 
+ * 
+ * @Summary
+ *  Queue a CONFIG write and return immediately. The gain and time values
+ *  used by the lux calculation are updated once the write has completed,
+ *  before cb is called. cb may be NULL.
+ * 
+ * @param instance - DATA_TSL2591 object to use
+ * @param again - Gain setting to use (TSL2591_CONFIG_AGAIN_LOW/MID/HIGH/MAX)
+ * @param atime - Time to use for analog conversion (TSL2591_CONFIG_ATIME_100MS...600MS)
+ * @param cb - Callback to trigger when the write has completed
+ * @param context - User Data to be delivered back through the callback
+ * 
+ */
+RET_TSL2591 DRV_TSL2591_SetConfigAsync(DATA_TSL2591* instance, uint8_t again, uint8_t atime, TSL2591_Async_CallBack cb, uintptr_t context);
+
+/** 
+ * @Function
+ *  RET_TSL2591 DRV_TSL2591_ComputeMilliLux ( uint8_t config, uint16_t ch0, uint16_t ch1, uint32_t* milliLux ) 
+ * 
+ * @Summary
+ *  Convert raw channel counts to milli-lux using integer arithmetic only.
+ *  Returns RET_TSL2591_SATURATED (and TSL2591_MILLILUX_SATURATED) when
+ *  either channel is at the ADC limit for the integration time. A dark
+ *  reading (ch0 == 0) or an IR-dominated one (ch1 >= ch0) gives 0.
+ * 
+ * @param config - CONFIG value the counts were taken with (again | atime)
+ * @param ch0 - Full spectrum channel count
+ * @param ch1 - IR channel count
+ * @param milliLux - Result in milli-lux
+ * 
+ */
+RET_TSL2591 DRV_TSL2591_ComputeMilliLux(uint8_t config, uint16_t ch0, uint16_t ch1, uint32_t* milliLux);
+
+/** 
+ * @Function
+ *  RET_TSL2591 DRV_TSL2591_SetAgc ( DATA_TSL2591* instance, bool enable ) 
+ * 
+ * @Summary
+ *  Enable or disable automatic gain / integration time control. While
+ *  enabled, DRV_TSL2591_AgcUpdate must be called with every sample.
+ * 
+ * @param instance - Driver Object to use
+ * @param enable - true to enable AGC
+ * 
+ */
+RET_TSL2591 DRV_TSL2591_SetAgc(DATA_TSL2591* instance, bool enable);
+
+/** 
+ * @Function
+ *  RET_TSL2591 DRV_TSL2591_AgcUpdate ( DATA_TSL2591* instance, RET_TSL2591 sampleResult ) 
+ * 
+ * @Summary
+ *  Run one AGC step on the sample just read. If the reading left the
+ *  usable band, a new configuration is chosen from the measured level
+ *  (gain first, integration time second), integration is restarted and
+ *  RET_TSL2591_AGC_ADJUSTING is returned: the reading should be dropped.
+ *  Otherwise sampleResult is returned unchanged. Uses blocking I2C, so it
+ *  must be called from task context, not from a TSL2591_Async_CallBack.
+ * 
+ * @param instance - Driver Object to use
+ * @param sampleResult - Result of the sample read (sync or async)
+ * 
+ */
+RET_TSL2591 DRV_TSL2591_AgcUpdate(DATA_TSL2591* instance, RET_TSL2591 sampleResult);
+
+/** 
+ * @Function
+ *  uint8_t DRV_TSL2591_GetAgcCycles ( DATA_TSL2591* instance ) 
+ * 
+ * @Summary
+ *  Return the number of integration cycles the last AGC adjustment took to
+ *  reach a valid reading (including that reading), or 0 if no adjustment
+ *  completed since the previous call.
+ * 
+ * @param instance - Driver Object to use
+ * 
+ */
+uint8_t DRV_TSL2591_GetAgcCycles(DATA_TSL2591* instance);
+
+/** 
+ * @Function
+ *  RET_TSL2591 DRV_TSL2591_SetChangeMode ( DATA_TSL2591* instance, bool enable, uint8_t windowPercent, uint8_t persist ) 
+ * 
+ * @Summary
+ *  Enable or disable report-on-change sampling. When enabled, the ALS
+ *  thresholds are programmed to a window of +/- windowPercent around the
+ *  last ch0 reading and re-centred after every sample, so the interrupt
+ *  only fires once the light level has left the window for `persist`
+ *  consecutive integration cycles. When disabled, the interrupt fires on
+ *  every integration cycle again.
+ * 
+ * @param instance - Driver Object to use
+ * @param enable - true to enable report-on-change
+ * @param windowPercent - Window half-width in percent of the last reading
+ * @param persist - Persistence filter (TSL2591_PERSIST_xxx)
+ * 
+ */
+RET_TSL2591 DRV_TSL2591_SetChangeMode(DATA_TSL2591* instance, bool enable, uint8_t windowPercent, uint8_t persist);
+
+/** 
+ * @Function
+ *  RET_TSL2591 DRV_TSL2591_SetNoPersistThresholds ( DATA_TSL2591* instance, bool enable, uint16_t low, uint16_t high ) 
+ * 
+ * @Summary
+ *  Arm or disarm the no-persist threshold channel. While armed, NPINTR is
+ *  raised at the end of the first integration cycle in which ch0 is below
+ *  low or above high, regardless of the ALS persistence filter. It shares
+ *  the interrupt pin with the persisted channel; use
+ *  DRV_TSL2591_GetInterruptClass after the sample read to tell them apart.
+ * 
+ * @param instance - Driver Object to use
+ * @param enable - true to arm the channel (sets NPIEN)
+ * @param low - Lower ch0 threshold, in counts
+ * @param high - Upper ch0 threshold, in counts
+ * 
+ */
+RET_TSL2591 DRV_TSL2591_SetNoPersistThresholds(DATA_TSL2591* instance, bool enable, uint16_t low, uint16_t high);
+
+/** 
+ * @Function
+ *  TSL2591_INT_CLASS DRV_TSL2591_GetInterruptClass ( DATA_TSL2591* instance ) 
+ * 
+ * @Summary
+ *  Return which interrupt(s) caused the last sample, decoded from the
+ *  STATUS byte read in the same burst as the channel data. No bus access.
+ * 
+ * @param instance - Driver Object to use
+ * 
+ */
+TSL2591_INT_CLASS DRV_TSL2591_GetInterruptClass(DATA_TSL2591* instance);
+
+/** 
+ * @Function
+ *  RET_TSL2591 DRV_TSL2591_SetOneShotMode ( DATA_TSL2591* instance, bool enable ) 
+ * 
+ * @Summary
+ *  Enter or leave one-shot acquisition. On entry the device is powered
+ *  down, report-on-change is turned off and the ALS interrupt is set to
+ *  fire on every cycle. Each DRV_TSL2591_TriggerOneShot then runs exactly
+ *  one integration; with SAI set the device goes back to sleep once the
+ *  interrupt is raised, and sample reads leave the interrupt pending so
+ *  it stays asleep until the next trigger. Leaving restores continuous
+ *  sampling.
+ * 
+ * @param instance - Driver Object to use
+ * @param enable - true to enter one-shot mode
+ * 
+ */
+RET_TSL2591 DRV_TSL2591_SetOneShotMode(DATA_TSL2591* instance, bool enable);
+
+/** 
+ * @Function
+ *  RET_TSL2591 DRV_TSL2591_TriggerOneShot ( DATA_TSL2591* instance ) 
+ * 
+ * @Summary
+ *  Start one integration in one-shot mode. The interrupt callback fires
+ *  when it completes; read it with DRV_TSL2591_GetRawValue(Async). Costs a
+ *  single bus transaction: the ENABLE write on the first trigger, the
+ *  interrupt clear (which wakes the device from SAI sleep) after that.
+ * 
+ * @param instance - Driver Object to use
+ * 
+ */
+RET_TSL2591 DRV_TSL2591_TriggerOneShot(DATA_TSL2591* instance);
+
+/** 
+ * @Function
+ *  RET_TSL2591 DRV_TSL2591_GetOneShotStats ( DATA_TSL2591* instance, TSL2591_ONESHOT_STATS* stats ) 
+ * 
+ * @Summary
+ *  Copy the one-shot energy statistics (samples, integrations, powered
+ *  time, bus transactions) accumulated since one-shot mode was entered.
+ * 
+ * @param instance - Driver Object to use
+ * @param stats - Destination
+ * 
+ */
+RET_TSL2591 DRV_TSL2591_GetOneShotStats(DATA_TSL2591* instance, TSL2591_ONESHOT_STATS* stats);
+
+/** 
+ * @Function
+ *  RET_TSL2591 DRV_TSL2591_ShadowInvalidate ( DATA_TSL2591* instance ) 
+ * 
+ * @Summary
+ *  Forget the cached register values, e.g. after the sensor has been
+ *  power cycled or reset behind the driver's back. The next write to each
+ *  register goes to the bus unconditionally.
+ * 
+ * @param instance - Driver Object to use
+ * 
+ */
+RET_TSL2591 DRV_TSL2591_ShadowInvalidate(DATA_TSL2591* instance);
+
+/** 
+ * @Function
+ *  RET_TSL2591 DRV_TSL2591_ShadowResync ( DATA_TSL2591* instance ) 
+ * 
+ * @Summary
+ *  Reload the cached register values from the device with one burst read
+ *  of ENABLE..PERSIST, and update the cached gain/time from CONFIG.
+ * 
+ * @param instance - Driver Object to use
+ * 
+ */
+RET_TSL2591 DRV_TSL2591_ShadowResync(DATA_TSL2591* instance);
+
+/** 
+ * @Function
+ *  uint32_t DRV_TSL2591_RingDrain ( DATA_TSL2591* instance, TSL2591_SAMPLE* samples, uint32_t maxSamples ) 
+ * 
+ * @Summary
+ *  Copy up to maxSamples of the oldest buffered samples out of the ring,
+ *  oldest first. Every valid sample read (sync or async, including those
+ *  completed in interrupt context) is appended to the ring; when it is
+ *  full, new samples are dropped and counted in ringOverflows. The ring is
+ *  single producer / single consumer: call this from one task only.
+ * 
+ * @param instance - Driver Object to use
+ * @param samples - Destination array
+ * @param maxSamples - Capacity of samples
+ * @return - Number of samples copied
+ * 
+ */
+uint32_t DRV_TSL2591_RingDrain(DATA_TSL2591* instance, TSL2591_SAMPLE* samples, uint32_t maxSamples);
+
+/** 
+ * @Function
+ *  uint32_t DRV_TSL2591_RingCount ( DATA_TSL2591* instance ) 
+ * 
+ * @Summary
+ *  Return the number of samples waiting in the ring.
+ * 
+ * @param instance - Driver Object to use
+ * 
+ */
+uint32_t DRV_TSL2591_RingCount(DATA_TSL2591* instance);
+
+/** 
+ * @Function
+ *  RET_TSL2591 DRV_TSL2591_ChainStart ( DATA_TSL2591* instance, TSL2591_Async_CallBack cb, uintptr_t context ) 
+ * 
+ * @Summary
+ *  Hand the sensor over to the hardware acquisition chain: the falling
+ *  edge of the sensor interrupt on EXTINT7 is routed through EVSYS to the
+ *  DMAC, which clears the interrupt and reads STATUS..C1DATAH over SERCOM3
+ *  without the CPU. Samples are decoded into the ring once every
+ *  TSL2591_CHAIN_BATCH readings, from the DMAC interrupt, and cb (may be
+ *  NULL) is called after each batch. The instance stays claimed until
+ *  DRV_TSL2591_ChainStop: other calls return RET_TSL2591_BUSY, and AGC and
+ *  the report-on-change window are not serviced. SERCOM3 is taken from
+ *  the I2C driver with DRV_I2C_BusAcquire, which holds the transfers of
+ *  every client; RET_TSL2591_BUSY if the bus does not drain within
+ *  TSL2591_CHAIN_ACQUIRE_MS. Not available in one-shot mode.
+ * 
+ * @param instance - DATA_TSL2591 object to use
+ * @param cb - Callback to trigger after each batch
+ * @param context - User Data to be delivered back through the callback
+ * 
+ */
+RET_TSL2591 DRV_TSL2591_ChainStart(DATA_TSL2591* instance, TSL2591_Async_CallBack cb, uintptr_t context);
+
+/** 
+ * @Function
+ *  RET_TSL2591 DRV_TSL2591_ChainStop ( DATA_TSL2591* instance ) 
+ * 
+ * @Summary
+ *  Stop the hardware acquisition chain and give SERCOM3 back to the I2C
+ *  driver. Samples of an incomplete batch are dropped. A readout already
+ *  under way is waited for, up to TSL2591_CHAIN_DRAIN_MS; one that does
+ *  not end is cut with a STOP and RET_TSL2591_I2C_TIMEOUT is returned.
+ * 
+ * @param instance - DATA_TSL2591 object to use
+ * 
+ */
+RET_TSL2591 DRV_TSL2591_ChainStop(DATA_TSL2591* instance);
+
+/** 
+ * @Function
+ *  RET_TSL2591 DRV_TSL2591_GetBusStats ( DATA_TSL2591* instance, TSL2591_BUS_STATS* stats ) 
+ * 
+ * @Summary
+ *  Copy the I2C bus speed negotiation state: the speed in use and the
+ *  ceiling found at init, the throughput achieved at the current speed
+ *  (issue to completion of each transfer, queueing included), and the
+ *  error and step counters. The speed drops one step after a burst of bus
+ *  errors and climbs back after a long error-free run. Timeouts are counted
+ *  apart and leave the speed alone: the driver has already cleared the bus.
+ * 
+ * @param instance - DATA_TSL2591 object to use
+ * @param stats - Destination
+ * 
+ */
+RET_TSL2591 DRV_TSL2591_GetBusStats(DATA_TSL2591* instance, TSL2591_BUS_STATS* stats);
+
+/** 
+ * @Function
+ *  uint8_t DRV_TSL2591_GetLastTransactionCount ( DATA_TSL2591* instance ) 
+ * 
+ * @Summary
+ *  Return the number of I2C transactions issued by the most recent
+ *  DRV_TSL2591_* call on this instance
+ * 
+ * @param instance - DATA_TSL2591 object to use
+ * 
+ */
+uint8_t DRV_TSL2591_GetLastTransactionCount(DATA_TSL2591* instance);
+
 /* Provide C++ Compatibility */
 #ifdef __cplusplus
 }
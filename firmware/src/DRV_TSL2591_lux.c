@@ -0,0 +1,74 @@
+/* ************************************************************************** */
+/** DRV_TSL2591_lux.c
+
+  @Company
+    Microchip, Inc
+
+  @File Name
+    DRV_TSL2591_lux.c
+
+  @Summary
+  Integer channel count to milli-lux conversion of the TSL2591 driver
+
+  @Description
+  See DRV_TSL2591_lux.h
+ */
+/* ************************************************************************** */
+
+#include "DRV_TSL2591_lux.h"
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+/* Section: File Scope or Global Data                                         */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+/**
+ * @brief Integer lux conversion.
+ * @details lux = (ch0 - ch1) * (1 - ch1 / ch0) / cpl, with
+ *  cpl = atime_ms * again / GDF, simplifies to
+ *  lux = (ch0 - ch1)^2 / ch0 * GDF / (atime_ms * again).
+ *  The per-config factor 1000 * GDF / (atime_ms * again) is tabulated in
+ *  Q16 at compile time, so a conversion costs two 32-bit divides and one
+ *  32x32->64 multiply.
+ */
+#define TSL2591_LUX_FACTOR_Q16(ms, gain) \
+    ((uint32_t)(((1000.0 * 900.0 * 65536.0) / ((double)(ms) * (double)(gain))) + 0.5))
+#define TSL2591_LUX_FACTOR_ROW(gain) { \
+    TSL2591_LUX_FACTOR_Q16(100, gain), TSL2591_LUX_FACTOR_Q16(200, gain), \
+    TSL2591_LUX_FACTOR_Q16(300, gain), TSL2591_LUX_FACTOR_Q16(400, gain), \
+    TSL2591_LUX_FACTOR_Q16(500, gain), TSL2591_LUX_FACTOR_Q16(600, gain) }
+
+/* Milli-lux per unit of (ch0 - ch1)^2 / ch0 in Q16, indexed [AGAIN][ATIME] */
+static const uint32_t luxFactorQ16[TSL2591_LUX_GAINS][TSL2591_LUX_TIMES] = {
+    TSL2591_LUX_FACTOR_ROW(1),
+    TSL2591_LUX_FACTOR_ROW(25),
+    TSL2591_LUX_FACTOR_ROW(428),
+    TSL2591_LUX_FACTOR_ROW(9876),
+};
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+// Section: Interface Functions                                               */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+uint32_t DRV_TSL2591_LuxFromCounts(uint8_t gain, uint8_t time, uint16_t ch0, uint16_t ch1) {
+    uint32_t diff, diffSq, ratioQ16;
+
+    if((ch0 == 0) || (ch1 >= ch0)) {
+        return 0;
+    }
+
+    // (ch0 - ch1)^2 / ch0 in Q16. The integer part is below 2^16 because
+    // diff <= ch0, and remainder < ch0 < 2^16 keeps the fraction in 32 bits.
+    diff = ch0 - ch1;
+    diffSq = diff * diff;
+    ratioQ16 = ((diffSq / ch0) << 16) | (((diffSq % ch0) << 16) / ch0);
+
+    return (uint32_t)(((uint64_t)ratioQ16 * luxFactorQ16[gain][time] + 0x80000000ULL) >> 32);
+}
+
+/* *****************************************************************************
+ End of File
+ */
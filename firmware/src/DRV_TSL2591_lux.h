@@ -0,0 +1,78 @@
+/* ************************************************************************** */
+/** DRV_TSL2591_lux.h
+
+  @Company
+    Microchip, Inc
+
+  @File Name
+    DRV_TSL2591_lux.h
+
+  @Summary
+  Integer channel count to milli-lux conversion of the TSL2591 driver
+
+  @Description
+  Kept free of Harmony and device headers so the exact code the driver runs
+  also builds on a host, see tools/lux_check.c. Saturation is decided by the
+  caller, DRV_TSL2591_ComputeMilliLux, which knows the ADC limits.
+ */
+/* ************************************************************************** */
+
+#ifndef DRV_TSL2591_LUX_H    /* Guard against multiple inclusion */
+#define DRV_TSL2591_LUX_H
+
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+/* Section: Included Files                                                    */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+#include <stdint.h>
+
+/* Provide C++ Compatibility */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+/* Section: Constants                                                         */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+/* Settings of the CONFIG AGAIN and ATIME fields, shifted down to 0 */
+#define TSL2591_LUX_GAINS                 4
+#define TSL2591_LUX_TIMES                 6
+
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+/* Section: Interface Functions                                               */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+/**
+ * @brief Convert unsaturated channel counts to milli-lux
+ *
+ * A dark reading (ch0 == 0) or an IR-dominated one (ch1 >= ch0) gives 0.
+ *
+ * @param gain - AGAIN field of CONFIG, shifted down (0 .. TSL2591_LUX_GAINS - 1)
+ * @param time - ATIME field of CONFIG (0 .. TSL2591_LUX_TIMES - 1)
+ * @param ch0 - Full spectrum channel count
+ * @param ch1 - IR channel count
+ * @return - Milli-lux, rounded to nearest
+ */
+uint32_t DRV_TSL2591_LuxFromCounts(uint8_t gain, uint8_t time, uint16_t ch0, uint16_t ch1);
+
+
+/* Provide C++ Compatibility */
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DRV_TSL2591_LUX_H */
+
+/* *****************************************************************************
+ End of File
+ */
@@ -30,6 +30,9 @@
 #include <stdio.h>
 #include <string.h>
 #include "app.h"
+#include "definitions.h"
+#include "dlog.h"
+#include "peripheral/sercom/i2c_master/plib_sercom3_i2c_master.h"
 
 // *****************************************************************************
 // *****************************************************************************
@@ -39,16 +42,178 @@
 
 APP_DATA appData;
 
+// *****************************************************************************
+// *****************************************************************************
+// Section: Application Local Functions
+// *****************************************************************************
+// *****************************************************************************
+
+static void APP_HistogramPrint(const char* name, const uint32_t* histogram) {
+    uint32_t k;
+
+    // Each non-empty bin as "below <upper bound in us>: <count>", one record per bin
+    for(k = 0; k < DRV_I2C_HISTOGRAM_BINS; k++) {
+        if(histogram[k] != 0) {
+            DLOG_INFO("  %s <%luus: %lu\r\n", name, (unsigned long)((2ULL << k) / (CPU_CLOCK_FREQUENCY / 1000000)), (unsigned long)histogram[k]);
+        }
+    }
+}
+
+static void APP_I2CStatisticsPrint(const char* name, const DRV_I2C_TRANSFER_STATISTICS* stats) {
+    DLOG_INFO("app.c I2C %s: %lu done, %lu bytes, %lu nack, %lu bus error, %lu arbitration lost, %lu aborted, %lu rejected\r\n",
+            name, (unsigned long)stats->completed, (unsigned long)stats->bytes,
+            (unsigned long)stats->nacks, (unsigned long)stats->busErrors,
+            (unsigned long)stats->arbitrationLosses, (unsigned long)stats->aborts,
+            (unsigned long)stats->rejected);
+    APP_HistogramPrint("wait", stats->waitHistogram);
+    APP_HistogramPrint("bus", stats->busHistogram);
+    APP_HistogramPrint("total", stats->totalHistogram);
+}
+
+#if APP_TELEMETRY_BINARY == 1
+static void APP_TelemetryFrameStart(APP_TELEMETRY* telemetry) {
+    telemetry->payload[0] = APP_TELEMETRY_FRAME_SAMPLES;
+    telemetry->payload[1] = 0;
+    telemetry->length = 2;
+    telemetry->records = 0;
+    // The first record of a frame is coded against zero
+    telemetry->lastSequence = 0xFFFFFFFFUL;
+    telemetry->lastTick = 0;
+    telemetry->lastInterval = 0;
+    telemetry->lastCh0 = 0;
+    telemetry->lastCh1 = 0;
+    telemetry->lastConfig = 0;
+    telemetry->lastMilliLux = 0;
+}
+
+static uint32_t APP_TelemetryVarint(uint8_t* out, int32_t value) {
+    // Zigzag folds the sign into bit 0 so small negative deltas stay short
+    uint32_t zigzag = ((uint32_t)value << 1) ^ (uint32_t)(value >> 31);
+    uint32_t n = 0;
+
+    while(zigzag >= 0x80) {
+        out[n++] = (uint8_t)(zigzag | 0x80);
+        zigzag >>= 7;
+    }
+    out[n++] = (uint8_t)zigzag;
+    return n;
+}
+
+static void APP_TelemetryFlush(APP_TELEMETRY* telemetry) {
+    uint32_t n;
+
+    if(telemetry->records == 0) {
+        return;
+    }
+    // Same framing as the log records, a frame the UART ring cannot take is dropped whole
+    n = DLOG_FrameWrite(telemetry->payload, telemetry->length);
+    if(n != 0) {
+        telemetry->frames++;
+        telemetry->bytes += n;
+    }
+    APP_TelemetryFrameStart(telemetry);
+}
+
+static void APP_TelemetryAdd(APP_TELEMETRY* telemetry, const TSL2591_SAMPLE* sample, uint32_t milliLux, bool luxValid) {
+    uint8_t* record;
+    uint8_t flags = 0;
+    uint32_t n = 1, interval;
+
+    // Room for the largest record, or a full record count
+    if(((telemetry->length + APP_TELEMETRY_RECORD_MAX) > APP_TELEMETRY_FRAME_SIZE) || (telemetry->records == 0xFF)) {
+        APP_TelemetryFlush(telemetry);
+    }
+    if(telemetry->records == 0) {
+        telemetry->startTick = xTaskGetTickCount();
+    }
+    record = &telemetry->payload[telemetry->length];
+
+    if(telemetry->sequence != (telemetry->lastSequence + 1)) {
+        flags |= APP_TELEMETRY_SEQUENCE;
+        n += APP_TelemetryVarint(&record[n], (int32_t)(telemetry->sequence - (telemetry->lastSequence + 1)));
+    }
+    // Periodic sampling repeats the same interval, only a change is sent
+    interval = sample->tick - telemetry->lastTick;
+    if(interval != telemetry->lastInterval) {
+        flags |= APP_TELEMETRY_TICK;
+        n += APP_TelemetryVarint(&record[n], (int32_t)(interval - telemetry->lastInterval));
+    }
+    if(sample->ch0 != telemetry->lastCh0) {
+        flags |= APP_TELEMETRY_CH0;
+        n += APP_TelemetryVarint(&record[n], (int32_t)sample->ch0 - (int32_t)telemetry->lastCh0);
+    }
+    if(sample->ch1 != telemetry->lastCh1) {
+        flags |= APP_TELEMETRY_CH1;
+        n += APP_TelemetryVarint(&record[n], (int32_t)sample->ch1 - (int32_t)telemetry->lastCh1);
+    }
+    if(sample->config != telemetry->lastConfig) {
+        flags |= APP_TELEMETRY_CONFIG;
+        record[n++] = sample->config;
+    }
+    if(!luxValid) {
+        flags |= APP_TELEMETRY_LUX_INVALID;
+    } else if(milliLux != telemetry->lastMilliLux) {
+        flags |= APP_TELEMETRY_MILLILUX;
+        n += APP_TelemetryVarint(&record[n], (int32_t)(milliLux - telemetry->lastMilliLux));
+        telemetry->lastMilliLux = milliLux;
+    }
+    record[0] = flags;
+
+    // The first interval of a frame is the absolute tick, not a prediction
+    telemetry->lastInterval = (telemetry->records == 0) ? 0 : interval;
+    telemetry->lastSequence = telemetry->sequence++;
+    telemetry->lastTick = sample->tick;
+    telemetry->lastCh0 = sample->ch0;
+    telemetry->lastCh1 = sample->ch1;
+    telemetry->lastConfig = sample->config;
+    telemetry->length += n;
+    telemetry->records++;
+    telemetry->payload[1] = (uint8_t)telemetry->records;
+}
+#endif
+
 // *****************************************************************************
 // *****************************************************************************
 // Section: Application Callback Functions
 // *****************************************************************************
 // *****************************************************************************
 
+static void APP_Notify(APP_DATA* intAppData, uint32_t events) {
+    BaseType_t higherPriorityTaskWoken = pdFALSE;
+
+    // A timed-out readout is completed from a task by the I2C driver
+    if(__get_IPSR() != 0U) {
+        xTaskNotifyFromISR(intAppData->task, events, eSetBits, &higherPriorityTaskWoken);
+        portYIELD_FROM_ISR(higherPriorityTaskWoken);
+    }
+    else {
+        xTaskNotify(intAppData->task, events, eSetBits);
+    }
+}
+
+void sampleCallback(DATA_TSL2591* instance, RET_TSL2591 result, uintptr_t context) {
+    APP_DATA* intAppData = (APP_DATA*)context;
+
+    // The interrupt class rides along, the task does not have to read it back
+    intAppData->sampleResult = result;
+    APP_Notify(intAppData, APP_EVENT_SAMPLE_DONE | ((uint32_t)DRV_TSL2591_GetInterruptClass(instance) << APP_EVENT_INT_SHIFT));
+}
+
+void chainCallback(DATA_TSL2591* instance, RET_TSL2591 result, uintptr_t context) {
+    APP_Notify((APP_DATA*)context, APP_EVENT_RING);
+}
+
 void eventCallback(uintptr_t context) {
     APP_DATA* intAppData = (APP_DATA*)context;
 
-    intAppData->sampleReady = true;
+    intAppData->eventCycles = DWT->CYCCNT;
+    intAppData->eventStamped = true;
+    TICKLESS_SensorEvent();
+    // Start the readout from the interrupt, the sample lands in the driver's
+    // ring even if APP_Tasks is late. Leave it to the task if the driver is busy.
+    if(DRV_TSL2591_GetRawValueAsync(&intAppData->driverData, &sampleCallback, context) != RET_TSL2591_SUCCESS) {
+        APP_Notify(intAppData, APP_EVENT_SAMPLE_REQUEST);
+    }
 }
 
 // *****************************************************************************
@@ -65,6 +230,19 @@ void APP_Initialize (const SYS_MODULE_INDEX drvIndex, int intpin)
     appData.driverData.drvIndex = drvIndex;
     appData.interruptPin = intpin;
     appData.sampleReady = true;  // Allows system to request the first sample after configuration
+    appData.pendingEvents = 0;
+    appData.eventStamped = false;
+    appData.latencyMax = 0;
+    appData.wakeups = 0;
+    memset(appData.latencyHistogram, 0, sizeof(appData.latencyHistogram));
+    appData.ringOverflows = 0;
+    // RTC time base of the tickless idle, before the scheduler takes SysTick
+    TICKLESS_Initialize();
+    appData.benchSamples = 0;
+#if APP_TELEMETRY_BINARY == 1
+    memset(&appData.telemetry, 0, sizeof(appData.telemetry));
+    APP_TelemetryFrameStart(&appData.telemetry);
+#endif
 }
 
 
@@ -77,21 +255,215 @@ void APP_Initialize (const SYS_MODULE_INDEX drvIndex, int intpin)
  */
 void APP_Tasks ( void )
 {
+    uint8_t agcCycles;
+    uint32_t count, i, milliLux, events, latency;
+    TickType_t timeout;
+#if APP_TELEMETRY_BINARY == 1
+    TickType_t elapsed, flushTimeout;
+#endif
+    bool luxValid;
+    SERCOM_I2C_BENCHMARK bench;
+    DRV_I2C_QUEUE_STATISTICS queueStats;
+    bool queueStatsValid;
+    TSL2591_BUS_STATS busStats;
+    DRV_I2C_TRANSFER_STATISTICS sensorStats, instanceStats;
+    USART_WRITE_STATISTICS consoleStats;
+    DLOG_STATISTICS logStats;
+    TICKLESS_STATISTICS sleepStats;
+    uint32_t sleepElapsed, sleepRate, sleepIdle, sensorRate;
 
     switch(appData.state) {
         case APP_STATE_INIT:
+            appData.task = xTaskGetCurrentTaskHandle();
             if(DRV_TSL2591_Initialize(&appData.driverData, appData.interruptPin) != RET_TSL2591_SUCCESS) {
-                printf("App.c: Error Initializing TSL Driver\r\n");
+                DLOG_ERROR("App.c: Error Initializing TSL Driver\r\n");
             }
+            DLOG_INFO("app.c Init I2C Transactions: %d\r\n", DRV_TSL2591_GetLastTransactionCount(&appData.driverData));
             DRV_TSL2591_RegisterCallback(&appData.driverData, &eventCallback, (void*)&appData);
+#if APP_HW_CHAIN == 1
+            // Every cycle is read by the DMAC and lands in the ring a batch at a time
+            appData.sampleReady = false;
+            if(DRV_TSL2591_ChainStart(&appData.driverData, &chainCallback, (uintptr_t)&appData) != RET_TSL2591_SUCCESS) {
+                DLOG_ERROR("app.c Error starting the acquisition chain\r\n");
+            }
+#else
+            DRV_TSL2591_SetAgc(&appData.driverData, true);
+            // Only wake up when the light moves by more than 10% for 3 cycles
+            DRV_TSL2591_SetChangeMode(&appData.driverData, true, 10, TSL2591_PERSIST_3);
+#endif
+            SERCOM3_I2C_BenchmarkReset();
+            // Idle sleeps around this sensor's integration cycle
+            TICKLESS_SensorSet(&appData.driverData);
+            TICKLESS_StatisticsGet(&appData.sleepStats);
             appData.state = APP_STATE_SERVICE_TASKS;
             break;
         case APP_STATE_SERVICE_TASKS:
+            // Sleep until a callback has work: a readout to retry polls, a
+            // partly filled telemetry frame bounds the wait, nothing else does
+            events = appData.pendingEvents;
+            appData.pendingEvents = 0;
+            if(events == 0) {
+                timeout = portMAX_DELAY;
+                if(appData.sampleReady) {
+                    timeout = pdMS_TO_TICKS(APP_RETRY_MS);
+                }
+#if APP_TELEMETRY_BINARY == 1
+                if(appData.telemetry.records != 0) {
+                    elapsed = xTaskGetTickCount() - appData.telemetry.startTick;
+                    flushTimeout = (elapsed < pdMS_TO_TICKS(APP_TELEMETRY_FLUSH_MS)) ? (pdMS_TO_TICKS(APP_TELEMETRY_FLUSH_MS) - elapsed) : 0;
+                    if(flushTimeout < timeout) {
+                        timeout = flushTimeout;
+                    }
+                }
+#endif
+                xTaskNotifyWait(0, 0xFFFFFFFFUL, &events, timeout);
+                appData.wakeups++;
+            }
+            if(events & APP_EVENT_SAMPLE_REQUEST) {
+                appData.sampleReady = true;
+            }
             if(appData.sampleReady) {
-                appData.sampleReady = false;
-                DRV_TSL2591_GetRawValue(&appData.driverData);
-                printf("app.c RawData: 0x%02x%02x%02x%02x\r\n", appData.driverData.rxBuffer[0], appData.driverData.rxBuffer[1], appData.driverData.rxBuffer[2], appData.driverData.rxBuffer[3]);
-                printf("app.c Lux:%d\r\n", appData.driverData.lux);
+                // The readout completes in the background, see sampleCallback
+                if(DRV_TSL2591_GetRawValueAsync(&appData.driverData, &sampleCallback, (uintptr_t)&appData) != RET_TSL2591_BUSY) {
+                    appData.sampleReady = false;
+                }
+            }
+            if(events & APP_EVENT_SAMPLE_DONE) {
+                // AGC follows the latest reading; ring records carry their own CONFIG
+                appData.sampleResult = DRV_TSL2591_AgcUpdate(&appData.driverData, appData.sampleResult);
+                agcCycles = DRV_TSL2591_GetAgcCycles(&appData.driverData);
+                if(agcCycles != 0) {
+                    DLOG_INFO("app.c AGC settled at CONFIG 0x%02x in %d cycles\r\n", appData.driverData.config, agcCycles);
+                }
+                if(events & APP_EVENT_INT_NO_PERSIST) {
+                    DLOG_WARNING("app.c Light alarm: CH0 0x%04x\r\n", appData.driverData.ch0);
+                }
+            }
+            count = DRV_TSL2591_RingDrain(&appData.driverData, appData.samples, APP_SAMPLE_BATCH);
+            if(count == APP_SAMPLE_BATCH) {
+                // More may be waiting, come back without sleeping
+                appData.pendingEvents |= APP_EVENT_RING;
+            }
+            if((count != 0) && appData.eventStamped) {
+                // Sensor interrupt to the sample in the task's hands
+                appData.eventStamped = false;
+                latency = DWT->CYCCNT - appData.eventCycles;
+                appData.latencyHistogram[31U - __CLZ(latency | 1U)]++;
+                if(latency > appData.latencyMax) {
+                    appData.latencyMax = latency;
+                }
+            }
+#if APP_TELEMETRY_BINARY == 1
+            // Samples lost to a full ring still use up sequence numbers, the host sees the gap
+            appData.telemetry.sequence += appData.driverData.ringOverflows - appData.telemetry.ringOverflows;
+            appData.telemetry.ringOverflows = appData.driverData.ringOverflows;
+#endif
+            for(i = 0; i < count; i++) {
+                luxValid = (DRV_TSL2591_ComputeMilliLux(appData.samples[i].config, appData.samples[i].ch0, appData.samples[i].ch1, &milliLux) == RET_TSL2591_SUCCESS);
+#if APP_TELEMETRY_BINARY == 1
+                APP_TelemetryAdd(&appData.telemetry, &appData.samples[i], milliLux, luxValid);
+#else
+                if(luxValid) {
+                    DLOG_INFO("app.c %lu: CH0 0x%04x CH1 0x%04x Lux:%lu\r\n", (unsigned long)appData.samples[i].tick, appData.samples[i].ch0, appData.samples[i].ch1, (unsigned long)(milliLux / 1000));
+                }
+#endif
+            }
+#if APP_TELEMETRY_BINARY == 1
+            if((appData.telemetry.records != 0) && ((xTaskGetTickCount() - appData.telemetry.startTick) >= pdMS_TO_TICKS(APP_TELEMETRY_FLUSH_MS))) {
+                APP_TelemetryFlush(&appData.telemetry);
+            }
+#endif
+            // I2C CPU cost per sample, including AGC and threshold writes
+            appData.benchSamples += count;
+            if(appData.benchSamples >= APP_BENCHMARK_SAMPLES) {
+                SERCOM3_I2C_BenchmarkGet(&bench);
+                SERCOM3_I2C_BenchmarkReset();
+                DLOG_INFO("app.c I2C %s: %lu.%lu irq, %lu cycles, %lu.%lu transfers per sample, %lu irq last / %lu max per transfer\r\n",
+                        (DRV_I2C_PLIB_DMA_IDX0 == 1) ? ((DRV_I2C_PLIB_SMART_IDX0 == 1) ? "smart" : "DMA") : "byte",
+                        (unsigned long)(bench.interrupts / appData.benchSamples), (unsigned long)((bench.interrupts * 10 / appData.benchSamples) % 10),
+                        (unsigned long)(bench.cycles / appData.benchSamples),
+                        (unsigned long)(bench.transfers / appData.benchSamples), (unsigned long)((bench.transfers * 10 / appData.benchSamples) % 10),
+                        (unsigned long)bench.lastTransferInterrupts, (unsigned long)bench.maxTransferInterrupts);
+                queueStatsValid = DRV_I2C_QueueStatisticsGet(appData.driverData.drvI2CHandle, &queueStats);
+                if(queueStatsValid && (queueStats.transfers[DRV_I2C_TRANSFER_PRIORITY_HIGH] != 0)) {
+                    DLOG_INFO("app.c I2C queue: max depth %lu, %lu overtakes, %lu chained from the ISR, sensor wait %lu avg %lu max cycles\r\n",
+                            (unsigned long)queueStats.queueDepthMax, (unsigned long)queueStats.overtakes,
+                            (unsigned long)queueStats.chainSteps,
+                            (unsigned long)(queueStats.waitCycles[DRV_I2C_TRANSFER_PRIORITY_HIGH] / queueStats.transfers[DRV_I2C_TRANSFER_PRIORITY_HIGH]),
+                            (unsigned long)queueStats.waitCyclesMax[DRV_I2C_TRANSFER_PRIORITY_HIGH]);
+                }
+                // ISR to task wake-up of the blocking transfers, compare with DRV_I2C_SYNC_TASK_NOTIFY 0
+                if(queueStatsValid && (queueStats.syncWakeups != 0)) {
+                    DLOG_INFO("app.c I2C %s wake: %lu avg %lu max cycles\r\n",
+                            (DRV_I2C_SYNC_TASK_NOTIFY == 1) ? "notify" : "semaphore",
+                            (unsigned long)(queueStats.syncWakeCycles / queueStats.syncWakeups),
+                            (unsigned long)queueStats.syncWakeCyclesMax);
+                }
+                DRV_TSL2591_GetBusStats(&appData.driverData, &busStats);
+                DLOG_INFO("app.c I2C bus: %lu kHz (max %lu), %lu bytes/s, %lu errors, %lu timeouts, %lu down %lu up\r\n",
+                        (unsigned long)(busStats.speedHz / 1000), (unsigned long)(busStats.speedMaxHz / 1000),
+                        (unsigned long)busStats.bytesPerSecond, (unsigned long)busStats.errors,
+                        (unsigned long)busStats.timeouts,
+                        (unsigned long)busStats.stepDowns, (unsigned long)busStats.stepUps);
+                if(queueStatsValid && (queueStats.timeouts != 0)) {
+                    DLOG_WARNING("app.c I2C timeouts: %lu, bus cleared %lu, still stuck %lu\r\n",
+                            (unsigned long)queueStats.timeouts, (unsigned long)queueStats.busRecoveries,
+                            (unsigned long)queueStats.busRecoveryFailures);
+                }
+                // Where the sensor's time goes on the shared bus, against all traffic
+                if(DRV_I2C_TransferStatisticsGet(appData.driverData.drvI2CHandle, &sensorStats, &instanceStats)) {
+                    APP_I2CStatisticsPrint("sensor", &sensorStats);
+                    APP_I2CStatisticsPrint("all", &instanceStats);
+                }
+                // Console output lost to a full transmit ring instead of stalling this task
+                SERCOM2_USART_WriteStatisticsGet(&consoleStats);
+                DLOG_INFO("app.c Console: %lu bytes queued, %lu dropped, %lu overwritten, %lu full writes, %lu / %lu bytes peak\r\n",
+                        (unsigned long)consoleStats.queuedBytes, (unsigned long)consoleStats.droppedBytes,
+                        (unsigned long)consoleStats.overwrittenBytes, (unsigned long)consoleStats.fullWrites,
+                        (unsigned long)consoleStats.highWater, (unsigned long)SERCOM2_USART_WriteBufferSizeGet());
+                SERCOM2_USART_WriteStatisticsReset();
+                DLOG_INFO("app.c Events: %lu wakeups for %lu samples, interrupt to sample %lu max cycles\r\n",
+                        (unsigned long)appData.wakeups, (unsigned long)appData.benchSamples, (unsigned long)appData.latencyMax);
+                APP_HistogramPrint("latency", appData.latencyHistogram);
+                memset(appData.latencyHistogram, 0, sizeof(appData.latencyHistogram));
+                appData.latencyMax = 0;
+                appData.wakeups = 0;
+                // Wake-ups and time asleep over the window, on the RTC
+                TICKLESS_StatisticsGet(&sleepStats);
+                sleepElapsed = sleepStats.now - appData.sleepStats.now;
+                if(sleepElapsed != 0) {
+                    sleepRate = (uint32_t)(((uint64_t)(sleepStats.sleeps - appData.sleepStats.sleeps) * sleepStats.countHz * 10U) / sleepElapsed);
+                    sleepIdle = (uint32_t)(((uint64_t)(sleepStats.sleptCounts - appData.sleepStats.sleptCounts) * 1000U) / sleepElapsed);
+                    sensorRate = (uint32_t)(((uint64_t)(sleepStats.sensorEvents - appData.sleepStats.sensorEvents) * sleepStats.countHz * 10U) / sleepElapsed);
+                    DLOG_INFO("app.c Sleep: %lu.%lu wakeups/s for %lu.%lu sensor interrupts/s, idle %lu.%lu%%, %lu of %lu sleeps in STANDBY, %lu ended by the RTC, %lu ticks skipped\r\n",
+                            (unsigned long)(sleepRate / 10), (unsigned long)(sleepRate % 10),
+                            (unsigned long)(sensorRate / 10), (unsigned long)(sensorRate % 10),
+                            (unsigned long)(sleepIdle / 10), (unsigned long)(sleepIdle % 10),
+                            (unsigned long)(sleepStats.standbySleeps - appData.sleepStats.standbySleeps),
+                            (unsigned long)(sleepStats.sleeps - appData.sleepStats.sleeps),
+                            (unsigned long)(sleepStats.timerWakeups - appData.sleepStats.timerWakeups),
+                            (unsigned long)(sleepStats.steppedTicks - appData.sleepStats.steppedTicks));
+                }
+                appData.sleepStats = sleepStats;
+                DLOG_StatisticsGet(&logStats);
+                DLOG_INFO("app.c Log: %lu records, %lu frames, %lu bytes, %lu frames dropped, %lu records truncated\r\n",
+                        (unsigned long)logStats.records, (unsigned long)logStats.frames, (unsigned long)logStats.bytes,
+                        (unsigned long)logStats.dropped, (unsigned long)logStats.truncated);
+#if APP_TELEMETRY_BINARY == 1
+                DLOG_INFO("app.c Telemetry: %lu frames, %lu bytes, %lu.%lu bytes per sample\r\n",
+                        (unsigned long)appData.telemetry.frames, (unsigned long)appData.telemetry.bytes,
+                        (unsigned long)(appData.telemetry.bytes / appData.benchSamples),
+                        (unsigned long)((appData.telemetry.bytes * 10 / appData.benchSamples) % 10));
+                appData.telemetry.frames = 0;
+                appData.telemetry.bytes = 0;
+#endif
+                DRV_I2C_TransferStatisticsReset(appData.driverData.drvI2CHandle);
+                DRV_I2C_QueueStatisticsReset(appData.driverData.drvI2CHandle);
+                appData.benchSamples = 0;
+            }
+            if(appData.driverData.ringOverflows != appData.ringOverflows) {
+                appData.ringOverflows = appData.driverData.ringOverflows;
+                DLOG_WARNING("app.c Samples dropped: %lu\r\n", (unsigned long)appData.ringOverflows);
             }
             break;
         case APP_STATE_ERROR:
@@ -34,6 +34,7 @@
 #include "configuration.h"
 #include "driver/i2c/drv_i2c.h"
 #include "DRV_TSL2591.h"
+#include "tickless.h"
 
 // DOM-IGNORE-BEGIN
 #ifdef __cplusplus  // Provide C++ Compatibility
@@ -49,6 +50,89 @@ extern "C" {
 // *****************************************************************************
 // *****************************************************************************
 
+/* Number of samples taken out of the driver ring per APP_Tasks pass */
+#define APP_SAMPLE_BATCH 8
+
+/* Number of samples between I2C PLib benchmark reports */
+#define APP_BENCHMARK_SAMPLES 64
+
+/* Read the sensor through the EIC -> EVSYS -> DMAC chain (1) instead of one
+   I2C driver readout per sensor interrupt (0) */
+#define APP_HW_CHAIN 0
+
+/* APP task notification bits (index 0), set from the interrupt callbacks.
+   The task blocks until one arrives instead of polling */
+#define APP_EVENT_SAMPLE_REQUEST    0x01    // Sensor interrupt, the ISR could not start the readout
+#define APP_EVENT_SAMPLE_DONE       0x02    // Readout finished, AGC to update and ring to drain
+#define APP_EVENT_RING              0x04    // Chain batch or leftovers in the driver ring
+#define APP_EVENT_INT_SHIFT         8       // TSL2591_INT_CLASS of the readout, shifted
+#define APP_EVENT_INT_ALS           (TSL2591_INT_ALS << APP_EVENT_INT_SHIFT)
+#define APP_EVENT_INT_NO_PERSIST    (TSL2591_INT_NO_PERSIST << APP_EVENT_INT_SHIFT)
+
+/* Wait before retrying a readout the driver was too busy to start */
+#define APP_RETRY_MS 10
+
+/* Stream samples as COBS framed binary records (1) instead of one log
+   line each (0), see tools/telemetry_decode.py */
+#define APP_TELEMETRY_BINARY 1
+
+/* Frame payload before CRC and COBS, at most DLOG_FRAME_MAX */
+#define APP_TELEMETRY_FRAME_SIZE 240
+
+/* A frame that is not full goes out once its first sample is this old */
+#define APP_TELEMETRY_FLUSH_MS 500
+
+/* Frame type byte, first byte of the payload */
+#define APP_TELEMETRY_FRAME_SAMPLES 0x01
+
+/* Record flags, one bit per field that differs from its prediction. Each
+   present field follows as a zigzag LEB128 delta, config as a raw byte */
+#define APP_TELEMETRY_SEQUENCE      0x01    // Sequence is not previous + 1
+#define APP_TELEMETRY_TICK          0x02    // Tick interval changed
+#define APP_TELEMETRY_CH0           0x04
+#define APP_TELEMETRY_CH1           0x08
+#define APP_TELEMETRY_CONFIG        0x10
+#define APP_TELEMETRY_MILLILUX      0x20
+#define APP_TELEMETRY_LUX_INVALID   0x40    // Saturated, no milli-lux
+
+/* Largest record: flags, five 32-bit varints and the config byte */
+#define APP_TELEMETRY_RECORD_MAX (1 + (5 * 5) + 1)
+
+// *****************************************************************************
+/* Telemetry frame under construction
+
+  Summary:
+    Holds the batch of sample records not yet sent
+
+  Description:
+    Records are delta coded against the previous record of the same frame,
+    the first record of a frame against zero, so each frame decodes on its
+    own. The payload is type, record count and records, sent by
+    DLOG_FrameWrite with a CRC-16/CCITT, COBS encoded between two 0x00
+    delimiters, interleaved with the log records.
+*/
+
+typedef struct
+{
+    uint8_t payload[APP_TELEMETRY_FRAME_SIZE];
+    uint32_t length;
+    uint32_t records;
+    uint32_t startTick;                 // RTOS tick the first record was added
+    uint32_t sequence;                  // Next sample number, skips ring overflows
+    uint32_t ringOverflows;             // Driver overflows already counted in sequence
+    // Previous record of the frame, the prediction for the next one
+    uint32_t lastSequence;
+    uint32_t lastTick;
+    uint32_t lastInterval;
+    uint16_t lastCh0;
+    uint16_t lastCh1;
+    uint8_t lastConfig;
+    uint32_t lastMilliLux;
+    uint32_t frames;
+    uint32_t bytes;                     // Encoded bytes sent, delimiters included
+
+} APP_TELEMETRY;
+
 // *****************************************************************************
 /* Application states
 
@@ -90,7 +174,20 @@ typedef struct
     APP_STATES state;
     DATA_TSL2591 driverData;
     int interruptPin;
-    bool sampleReady;
+    TaskHandle_t task;                  // Woken by the callbacks, see APP_EVENT_xxx
+    bool sampleReady;                   // Readout still to start from the task
+    uint32_t pendingEvents;             // Work left over from the last pass
+    volatile RET_TSL2591 sampleResult;
+    volatile uint32_t eventCycles;      // DWT cycle count of the last sensor interrupt
+    volatile bool eventStamped;         // eventCycles not yet matched to a sample
+    uint32_t latencyHistogram[DRV_I2C_HISTOGRAM_BINS];  // Interrupt to sample in the task, log2 cycles
+    uint32_t latencyMax;
+    uint32_t wakeups;                   // Task wake-ups since the last report
+    TICKLESS_STATISTICS sleepStats;     // Idle sleep counters at the last report
+    TSL2591_SAMPLE samples[APP_SAMPLE_BATCH];
+    uint32_t ringOverflows;
+    uint32_t benchSamples;
+    APP_TELEMETRY telemetry;
 
 } APP_DATA;
 
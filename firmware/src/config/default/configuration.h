@@ -88,8 +88,36 @@ extern "C" {
 // *****************************************************************************
 /* I2C Driver Instance 0 Configuration Options */
 #define DRV_I2C_INDEX_0                       0
-#define DRV_I2C_CLIENTS_NUMBER_IDX0           1
-#define DRV_I2C_CLOCK_SPEED_IDX0              100
+#define DRV_I2C_CLIENTS_NUMBER_IDX0           2
+#define DRV_I2C_QUEUE_SIZE_IDX0               8
+#define DRV_I2C_CLOCK_SPEED_IDX0              100000
+
+/* Time an I2C0 transfer may spend on the bus before it is aborted and the bus
+   cleared, in ms (0 waits forever). Enforced for queued transfers by the
+   driver task, which only wakes while a transfer is on the bus */
+#define DRV_I2C_TRANSFER_TIMEOUT_MS_IDX0      50
+#define DRV_I2C_RTOS_STACK_SIZE_IDX0          512
+#define DRV_I2C_RTOS_TASK_PRIORITY_IDX0       1
+
+/* Route the I2C0 PLib read/write entries through the SERCOM3 DMA path (1) or
+   the byte-per-interrupt path (0) */
+#define DRV_I2C_PLIB_DMA_IDX0                 1
+
+/* Route the I2C0 PLib write-read entry (register reads) through the SERCOM3
+   smart variant, one interrupt per read (1), or the plain DMA path (0).
+   Requires DRV_I2C_PLIB_DMA_IDX0 1 */
+#define DRV_I2C_PLIB_SMART_IDX0               0
+
+/* TSL2591 hardware acquisition chain: EIC EXTINT7 -> EVSYS channel 0 ->
+   DMAC, running the SERCOM3 I2C master without the I2C driver */
+#define DRV_TSL2591_CHAIN_I2C_REGS            (&SERCOM3_REGS->I2CM)
+#define DRV_TSL2591_CHAIN_RX_CHANNEL          DMAC_CHANNEL_2
+#define DRV_TSL2591_CHAIN_TX_CHANNEL          DMAC_CHANNEL_3
+#define DRV_TSL2591_CHAIN_HEAD_CHANNEL        DMAC_CHANNEL_4
+
+/* Wake tasks blocked in an I2C transfer with a direct task notification (1)
+   or an OSAL semaphore (0) */
+#define DRV_I2C_SYNC_TASK_NOTIFY              1
 
 /* I2C Driver Common Configuration Options */
 #define DRV_I2C_INSTANCES_NUMBER              1
@@ -103,6 +131,11 @@ extern "C" {
 // *****************************************************************************
 // *****************************************************************************
 
+/* Deferred logging (dlog.h): levels above DLOG_LEVEL compile out, DLOG_DEFERRED
+   0 formats on target with printf instead of sending format IDs */
+#define DLOG_LEVEL                            DLOG_LEVEL_INFO
+#define DLOG_DEFERRED                         1
+
 
 // *****************************************************************************
 // *****************************************************************************
@@ -222,8 +222,12 @@ typedef enum
     the client's data) instance of the client that made the buffer add request.
 
     The event handler function executes in the peripheral's interrupt
-    context. It is recommended of the application to not perform process
-    intensive or blocking operations with in this function.
+    context. A transfer retired by the transfer timeout is reported from task
+    context instead, by the DRV_I2C task or by a client blocked in a
+    synchronous transfer. The handler must therefore check __get_IPSR() before
+    calling FreeRTOS APIs that have a separate FromISR form. It is recommended
+    of the application to not perform process intensive or blocking
+    operations with in this function.
 
     The DRV_I2C_ReadTransferAdd, DRV_I2C_WriteTransferAdd and
     DRV_I2C_WriteReadTransferAdd functions can be called in the event handler to
@@ -234,6 +238,199 @@ typedef enum
 
 typedef void (*DRV_I2C_TRANSFER_EVENT_HANDLER )( DRV_I2C_TRANSFER_EVENT event, DRV_I2C_TRANSFER_HANDLE transferHandle, uintptr_t context );
 
+// *****************************************************************************
+/* I2C Driver Transfer Priority
+
+   Summary:
+    Identifies the priority of a transfer in the driver queue.
+
+   Description:
+    Transfers are started in priority order, and in submission order within
+    the same priority. A transfer already on the bus is never preempted.
+
+   Remarks:
+    A client's priority is set with DRV_I2C_TransferPrioritySet and applies
+    to the transfers it submits afterwards. A steady stream of higher
+    priority transfers can delay lower priority ones indefinitely.
+*/
+
+typedef enum
+{
+    /* Bulk traffic */
+    DRV_I2C_TRANSFER_PRIORITY_LOW = 0,
+
+    /* Default priority of a newly opened client */
+    DRV_I2C_TRANSFER_PRIORITY_NORMAL = 1,
+
+    /* Time-critical transfers, e.g. sensor readouts */
+    DRV_I2C_TRANSFER_PRIORITY_HIGH = 2,
+
+    DRV_I2C_TRANSFER_PRIORITY_NUMBER = 3
+
+} DRV_I2C_TRANSFER_PRIORITY;
+
+// *****************************************************************************
+/* I2C Driver Chain Transfer
+
+   Summary:
+    One transaction of a transfer chain.
+
+   Description:
+    A transaction writes writeSize bytes, reads readSize bytes, or writes
+    then reads after a repeated start when both sizes are set.
+
+   Remarks:
+    Used with DRV_I2C_ChainTransfer and DRV_I2C_ChainTransferAdd. The entries
+    and their buffers must stay valid until the chain has completed.
+*/
+
+typedef struct
+{
+    /* Slave address */
+    uint16_t                        address;
+
+    /* Bytes to write, NULL for a read */
+    void*                           writeBuffer;
+
+    /* Number of bytes to write, 0 for a read */
+    size_t                          writeSize;
+
+    /* Destination of the bytes read, NULL for a write */
+    void*                           readBuffer;
+
+    /* Number of bytes to read, 0 for a write */
+    size_t                          readSize;
+
+} DRV_I2C_CHAIN_TRANSFER;
+
+// *****************************************************************************
+/* I2C Driver Queue Statistics
+
+   Summary:
+    Transfer queue depth and wait time statistics of a driver instance.
+
+   Description:
+    The wait time of a transfer runs from its submission to the moment it is
+    handed to the PLIB, in CPU cycles counted by the DWT cycle counter. It
+    is accounted by the priority the transfer was queued with.
+
+   Remarks:
+    Returned by DRV_I2C_QueueStatisticsGet.
+*/
+
+typedef struct
+{
+    /* Transfers queued or on the bus right now */
+    uint32_t                        queueDepth;
+
+    /* Largest queueDepth seen */
+    uint32_t                        queueDepthMax;
+
+    /* Transfers queued ahead of an earlier, lower priority transfer */
+    uint32_t                        overtakes;
+
+    /* Transfers started, per priority */
+    uint32_t                        transfers[DRV_I2C_TRANSFER_PRIORITY_NUMBER];
+
+    /* Sum of the wait times, per priority */
+    uint64_t                        waitCycles[DRV_I2C_TRANSFER_PRIORITY_NUMBER];
+
+    /* Longest wait time, per priority */
+    uint32_t                        waitCyclesMax[DRV_I2C_TRANSFER_PRIORITY_NUMBER];
+
+    /* Blocking transfers completed */
+    uint32_t                        syncWakeups;
+
+    /* Sum of the cycles from the completion interrupt to the blocked task
+     * running again */
+    uint64_t                        syncWakeCycles;
+
+    /* Longest completion to wake-up time */
+    uint32_t                        syncWakeCyclesMax;
+
+    /* Transfers aborted because they outlived their client's timeout,
+     * including blocking transfers that could not get the driver in time */
+    uint32_t                        timeouts;
+
+    /* Bus clears after a timeout that left SDA released */
+    uint32_t                        busRecoveries;
+
+    /* Bus clears after a timeout that left SDA held low */
+    uint32_t                        busRecoveryFailures;
+
+    /* Chain transactions started from the completion interrupt of the
+     * previous one */
+    uint32_t                        chainSteps;
+
+} DRV_I2C_QUEUE_STATISTICS;
+
+// *****************************************************************************
+/* I2C Driver Latency Histogram Size
+
+   Summary:
+    Number of bins of a transfer latency histogram.
+
+   Description:
+    Bin k counts the latencies of 2^k to 2^(k+1) - 1 CPU cycles, bin 0 also
+    counts a latency of 0. 32 bins cover the whole DWT cycle counter range.
+
+   Remarks:
+    None.
+*/
+
+#define DRV_I2C_HISTOGRAM_BINS              32
+
+// *****************************************************************************
+/* I2C Driver Transfer Statistics
+
+   Summary:
+    Bus level counters and latency histograms of a driver instance or client.
+
+   Description:
+    A transfer is accounted when it completes or fails. Its latencies are
+    measured with the DWT cycle counter from its submission to the moment
+    it is handed to the PLIB (wait), from there to its completion (bus), and
+    over both (total). A chain is accounted as one transfer.
+
+   Remarks:
+    Returned by DRV_I2C_TransferStatisticsGet.
+*/
+
+typedef struct
+{
+    /* Transfers that completed */
+    uint32_t                        completed;
+
+    /* Payload bytes of the completed transfers, address bytes excluded */
+    uint32_t                        bytes;
+
+    /* Transfers NACKed by the slave */
+    uint32_t                        nacks;
+
+    /* Transfers ended by a bus error */
+    uint32_t                        busErrors;
+
+    /* Transfers that lost the bus to another master */
+    uint32_t                        arbitrationLosses;
+
+    /* Transfers aborted on timeout */
+    uint32_t                        aborts;
+
+    /* Transfers the PLIB did not accept, they never reached the bus and
+     * are left out of the histograms */
+    uint32_t                        rejected;
+
+    /* Submission to bus start */
+    uint32_t                        waitHistogram[DRV_I2C_HISTOGRAM_BINS];
+
+    /* Bus start to completion */
+    uint32_t                        busHistogram[DRV_I2C_HISTOGRAM_BINS];
+
+    /* Submission to completion */
+    uint32_t                        totalHistogram[DRV_I2C_HISTOGRAM_BINS];
+
+} DRV_I2C_TRANSFER_STATISTICS;
+
 
 // *****************************************************************************
 // *****************************************************************************
@@ -360,6 +557,90 @@ SYS_MODULE_OBJ DRV_I2C_Initialize( const SYS_MODULE_INDEX drvIndex, const SYS_MO
 
 SYS_STATUS DRV_I2C_Status( const SYS_MODULE_OBJ object);
 
+// *****************************************************************************
+/* Function:
+    void DRV_I2C_Tasks( const SYS_MODULE_OBJ object )
+
+  Summary:
+    Enforces the transfer timeouts of the I2C driver module.
+
+  Description:
+    This routine aborts the transfer on the bus once it has outlived the
+    timeout of the client that submitted it. The bus is then cleared and the
+    peripheral re-initialized through the PLIB, and the transfer is retired
+    with DRV_I2C_ERROR_TIMEOUT before the next queued transfer is started.
+
+  Precondition:
+    Function DRV_I2C_Initialize should have been called before calling this
+    function.
+
+  Parameters:
+    object - Driver object handle, returned from the DRV_I2C_Initialize routine
+
+  Returns:
+    None.
+
+  Example:
+    <code>
+    SYS_MODULE_OBJ      object;     // Returned from DRV_I2C_Initialize
+
+    while (true)
+    {
+        DRV_I2C_Tasks (object);
+
+        // Do other tasks
+    }
+    </code>
+
+  Remarks:
+    Blocking transfers enforce their own timeout. This routine is needed for
+    the queued transfers. Under an RTOS its task blocks for
+    DRV_I2C_TasksWaitTicks on notification index DRV_I2C_TASKS_NOTIFY_INDEX,
+    which the driver gives each time a transfer goes on the bus, so it only
+    runs while a transfer can time out. It must not be called from an
+    interrupt.
+*/
+
+void DRV_I2C_Tasks( const SYS_MODULE_OBJ object );
+
+// *****************************************************************************
+/* Function:
+    uint32_t DRV_I2C_TasksWaitTicks( const SYS_MODULE_OBJ object )
+
+  Summary:
+    Returns how long the task running DRV_I2C_Tasks may block.
+
+  Description:
+    This routine returns the ticks left before the transfer on the bus
+    outlives its client's timeout, or portMAX_DELAY when the bus is idle or
+    the transfer has no timeout. A transfer started later wakes the task
+    through its notification.
+
+  Precondition:
+    Function DRV_I2C_Initialize should have been called before calling this
+    function.
+
+  Parameters:
+    object - Driver object handle, returned from the DRV_I2C_Initialize routine
+
+  Returns:
+    RTOS ticks to block for, 0 if DRV_I2C_Tasks is due now.
+
+  Example:
+    <code>
+    while (true)
+    {
+        DRV_I2C_Tasks (object);
+        ulTaskNotifyTake (pdTRUE, DRV_I2C_TasksWaitTicks (object));
+    }
+    </code>
+
+  Remarks:
+    None.
+*/
+
+uint32_t DRV_I2C_TasksWaitTicks( const SYS_MODULE_OBJ object );
+
 // *****************************************************************************
 // *****************************************************************************
 // Section: I2C Driver Common Client Interface Routines
@@ -936,6 +1217,146 @@ void DRV_I2C_WriteReadTransferAdd (
     DRV_I2C_TRANSFER_HANDLE * const transferHandle
 );
 
+// *****************************************************************************
+/* Function:
+    void DRV_I2C_WriteVectorTransferAdd(
+        const DRV_HANDLE handle,
+        const uint16_t address,
+        const DRV_I2C_SEGMENT * const segments,
+        const size_t segmentCount,
+        DRV_I2C_TRANSFER_HANDLE * const transferHandle
+    )
+
+  Summary:
+    Queues a vectored write operation.
+
+  Description:
+    This function schedules a non-blocking write of the bytes of all the
+    segments, in order, as one bus transaction. The function returns
+    immediately; completion is reported like for DRV_I2C_WriteTransferAdd.
+
+  Precondition:
+    DRV_I2C_Open must have been called to obtain a valid opened device handle.
+
+  Parameters:
+    handle - Handle of the communication channel as returned by the
+    DRV_I2C_Open function.
+
+    address - Slave address
+
+    segments - Array of segments to send. Segments may be empty, but not
+    all of them.
+
+    segmentCount - Number of entries in segments.
+
+    transferHandle - Pointer to an argument that will contain the return
+    transfer handle. This will be DRV_I2C_TRANSFER_HANDLE_INVALID if the
+    function was not successful.
+
+  Returns:
+    None.
+
+  Example:
+    <code>
+    uint8_t reg = MY_REGISTER;
+    DRV_I2C_SEGMENT segments[2] = {
+        { &reg, 1 },
+        { myPayload, MY_PAYLOAD_SIZE }
+    };
+    DRV_I2C_TRANSFER_HANDLE transferHandle;
+
+    DRV_I2C_WriteVectorTransferAdd(myI2CHandle, slaveAddress, segments, 2, &transferHandle);
+
+    if(transferHandle == DRV_I2C_TRANSFER_HANDLE_INVALID)
+    {
+        // Error handling here
+    }
+    </code>
+
+  Remarks:
+    The segment array and every buffer it points to must stay valid until
+    the transfer has completed.
+    This function is available only in the asynchronous mode.
+*/
+
+void DRV_I2C_WriteVectorTransferAdd(
+    const DRV_HANDLE handle,
+    const uint16_t address,
+    const DRV_I2C_SEGMENT * const segments,
+    const size_t segmentCount,
+    DRV_I2C_TRANSFER_HANDLE * const transferHandle
+);
+
+// *****************************************************************************
+/* Function:
+    void DRV_I2C_ChainTransferAdd(
+        const DRV_HANDLE handle,
+        const DRV_I2C_CHAIN_TRANSFER * const chain,
+        const size_t count,
+        DRV_I2C_TRANSFER_HANDLE * const transferHandle
+    )
+
+  Summary:
+    Queues a chain of transactions.
+
+  Description:
+    This function schedules the transactions of the chain, in order, as one
+    entry of the driver queue. Each transaction is started from the
+    completion interrupt of the previous one, and no other transfer gets on
+    the bus in between. The event handler is called once, with
+    DRV_I2C_TRANSFER_EVENT_COMPLETE when the last transaction has completed,
+    or with DRV_I2C_TRANSFER_EVENT_ERROR as soon as one has failed. The
+    transactions after a failed one are not started.
+
+  Precondition:
+    DRV_I2C_Open must have been called to obtain a valid opened device handle.
+
+  Parameters:
+    handle - Handle of the communication channel as returned by the
+    DRV_I2C_Open function.
+
+    chain - Array of transactions.
+
+    count - Number of entries in chain.
+
+    transferHandle - Pointer to an argument that will contain the return
+    transfer handle. This will be DRV_I2C_TRANSFER_HANDLE_INVALID if the
+    function was not successful.
+
+  Returns:
+    None.
+
+  Example:
+    <code>
+    uint8_t clear = MY_CLEAR_COMMAND;
+    uint8_t reg = MY_DATA_REGISTER;
+    DRV_I2C_CHAIN_TRANSFER chain[2] = {
+        { slaveAddress, &reg, 1, myData, MY_DATA_SIZE },
+        { slaveAddress, &clear, 1, NULL, 0 }
+    };
+    DRV_I2C_TRANSFER_HANDLE transferHandle;
+
+    DRV_I2C_ChainTransferAdd(myI2CHandle, chain, 2, &transferHandle);
+
+    if(transferHandle == DRV_I2C_TRANSFER_HANDLE_INVALID)
+    {
+        // Error handling here
+    }
+    </code>
+
+  Remarks:
+    The timeout set with DRV_I2C_TransferTimeoutSet applies to each
+    transaction of the chain.
+    This function is available only in the asynchronous mode.
+*/
+
+void DRV_I2C_ChainTransferAdd(
+    const DRV_HANDLE handle,
+    const DRV_I2C_CHAIN_TRANSFER * const chain,
+    const size_t count,
+    DRV_I2C_TRANSFER_HANDLE * const transferHandle
+);
+
 // *****************************************************************************
 /* Function:
     void DRV_I2C_TransferEventHandlerSet
@@ -1049,31 +1470,372 @@ void DRV_I2C_TransferEventHandlerSet(
 
 // *****************************************************************************
 /* Function:
-    DRV_I2C_TRANSFER_EVENT DRV_I2C_TransferStatusGet(
-        const DRV_I2C_TRANSFER_HANDLE transferHandle
+    bool DRV_I2C_TransferPrioritySet(
+        const DRV_HANDLE handle,
+        const DRV_I2C_TRANSFER_PRIORITY priority
     )
 
   Summary:
-    Returns the status of the write/read/write-read transfer request.
+    Sets the queue priority of the client's transfers.
 
   Description:
-    This function can be used to poll the status of the queued transfer request
-    if the application doesn't prefer to use the event handler (callback)
-    function to get notified.
+    Transfers submitted by the client after this call, queued or blocking,
+    are placed in the driver queue behind every pending transfer of the
+    same or higher priority and ahead of the lower priority ones.
 
   Precondition:
     DRV_I2C_Open must have been called to obtain a valid opened device handle.
 
-    Either the DRV_I2C_ReadTransferAdd, DRV_I2C_WriteTransferAdd or
-    DRV_I2C_WriteReadTransferAdd function must have been called and a valid
-    buffer handle returned.
-
   Parameters:
-    transferHandle - Handle for the buffer of which the processed number of
-    bytes to be obtained.
+    handle - A valid open-instance handle, returned from the driver's open
+    routine DRV_I2C_Open function.
+
+    priority - Priority of the following transfers.
 
   Returns:
-    The success or error event of the transfer.
+    true - if the priority was set.
+
+    false - if the handle or the priority is not valid.
+
+  Example:
+    <code>
+    // myI2CHandle is the handle returned
+    // by the DRV_I2C_Open function.
+
+    DRV_I2C_TransferPrioritySet(myI2CHandle, DRV_I2C_TRANSFER_PRIORITY_HIGH);
+    </code>
+
+  Remarks:
+    Transfers already queued keep their priority.
+*/
+
+bool DRV_I2C_TransferPrioritySet( const DRV_HANDLE handle, const DRV_I2C_TRANSFER_PRIORITY priority );
+
+// *****************************************************************************
+/* Function:
+    bool DRV_I2C_TransferTimeoutSet(
+        const DRV_HANDLE handle,
+        const uint16_t timeoutMs
+    )
+
+  Summary:
+    Sets the timeout of the client's transfers.
+
+  Description:
+    A transfer of the client, queued or blocking, that has not completed
+    timeoutMs milliseconds after it was started on the bus is aborted. The
+    bus is cleared, the peripheral re-initialized and the transfer ends with
+    DRV_I2C_TRANSFER_EVENT_ERROR and DRV_I2C_ERROR_TIMEOUT. A blocking
+    transfer also fails with DRV_I2C_ERROR_TIMEOUT if the driver is not
+    free within timeoutMs.
+
+  Precondition:
+    DRV_I2C_Open must have been called to obtain a valid opened device handle.
+
+  Parameters:
+    handle - A valid open-instance handle, returned from the driver's open
+    routine DRV_I2C_Open function.
+
+    timeoutMs - Timeout in milliseconds, 0 waits forever.
+
+  Returns:
+    true - if the timeout was set.
+
+    false - if the handle is not valid.
+
+  Example:
+    <code>
+    // myI2CHandle is the handle returned
+    // by the DRV_I2C_Open function.
+
+    DRV_I2C_TransferTimeoutSet(myI2CHandle, 20);
+    </code>
+
+  Remarks:
+    The default is the transferTimeout of the DRV_I2C_INIT data. The time a
+    transfer waits in the queue does not count against its timeout.
+*/
+
+bool DRV_I2C_TransferTimeoutSet( const DRV_HANDLE handle, const uint16_t timeoutMs );
+
+// *****************************************************************************
+/* Function:
+    bool DRV_I2C_BusAcquire(
+        const DRV_HANDLE handle,
+        const uint16_t waitMs
+    )
+
+  Summary:
+    Takes the peripheral over from the driver.
+
+  Description:
+    Holds back every queued transfer of the instance, whichever client
+    queued it, and waits until the transfer on the bus, if any, has ended.
+    From then on the client may drive the peripheral directly, for example
+    from the DMAC, until DRV_I2C_BusRelease: the driver starts nothing and
+    the transfer timeout check, with its bus recovery and peripheral
+    re-initialization, skips the instance.
+
+  Precondition:
+    DRV_I2C_Open must have been called to obtain a valid opened device handle.
+
+  Parameters:
+    handle - A valid open-instance handle, returned from the driver's open
+    routine DRV_I2C_Open function.
+
+    waitMs - Longest wait for the bus to drain, in milliseconds. 0 only
+    takes a bus that is idle already.
+
+  Returns:
+    true - if the client owns the peripheral.
+
+    false - if the handle is not valid, another client owns or is acquiring
+    the peripheral, or the transfer on the bus did not end within waitMs.
+    The held transfers are let go again.
+
+  Example:
+    <code>
+    // myI2CHandle is the handle returned
+    // by the DRV_I2C_Open function.
+
+    if (DRV_I2C_BusAcquire(myI2CHandle, 100) == true)
+    {
+        // Use the PLIB or its DMA triggers directly
+
+        DRV_I2C_BusRelease(myI2CHandle);
+    }
+    </code>
+
+  Remarks:
+    Must be called from a task. Blocking transfers of other clients wait
+    while the peripheral is owned, for as long as it takes.
+*/
+
+bool DRV_I2C_BusAcquire( const DRV_HANDLE handle, const uint16_t waitMs );
+
+// *****************************************************************************
+/* Function:
+    void DRV_I2C_BusRelease( const DRV_HANDLE handle )
+
+  Summary:
+    Hands the peripheral back to the driver.
+
+  Description:
+    Ends the ownership taken with DRV_I2C_BusAcquire and starts the held
+    transfers. The baud rate is reprogrammed before the next transfer. The
+    peripheral must be idle, with its interrupts as the PLIB left them.
+
+  Precondition:
+    DRV_I2C_BusAcquire must have returned true for the handle.
+
+  Parameters:
+    handle - A valid open-instance handle, returned from the driver's open
+    routine DRV_I2C_Open function.
+
+  Returns:
+    None.
+
+  Example:
+    <code>
+    DRV_I2C_BusRelease(myI2CHandle);
+    </code>
+
+  Remarks:
+    Does nothing if the client does not own the peripheral.
+*/
+
+void DRV_I2C_BusRelease( const DRV_HANDLE handle );
+
+// *****************************************************************************
+/* Function:
+    bool DRV_I2C_QueueStatisticsGet(
+        const DRV_HANDLE handle,
+        DRV_I2C_QUEUE_STATISTICS* const stats
+    )
+
+  Summary:
+    Returns the queue statistics of the driver instance.
+
+  Description:
+    Copies the queue depth and wait time statistics of the driver instance
+    the client belongs to. The statistics cover all clients of the instance.
+
+  Precondition:
+    DRV_I2C_Open must have been called to obtain a valid opened device handle.
+
+  Parameters:
+    handle - A valid open-instance handle, returned from the driver's open
+    routine DRV_I2C_Open function.
+
+    stats - Destination of the statistics.
+
+  Returns:
+    true - if the statistics were copied.
+
+    false - if the handle is not valid.
+
+  Example:
+    <code>
+    DRV_I2C_QUEUE_STATISTICS stats;
+
+    if (DRV_I2C_QueueStatisticsGet(myI2CHandle, &stats) == true)
+    {
+        // Average wait of the high priority transfers, in cycles
+        avg = stats.waitCycles[DRV_I2C_TRANSFER_PRIORITY_HIGH] /
+              stats.transfers[DRV_I2C_TRANSFER_PRIORITY_HIGH];
+    }
+    </code>
+
+  Remarks:
+    None.
+*/
+
+bool DRV_I2C_QueueStatisticsGet( const DRV_HANDLE handle, DRV_I2C_QUEUE_STATISTICS* const stats );
+
+// *****************************************************************************
+/* Function:
+    void DRV_I2C_QueueStatisticsReset( const DRV_HANDLE handle )
+
+  Summary:
+    Clears the queue statistics of the driver instance.
+
+  Description:
+    Clears the counters, wait times and the maximum queue depth. The current
+    queue depth is kept.
+
+  Precondition:
+    DRV_I2C_Open must have been called to obtain a valid opened device handle.
+
+  Parameters:
+    handle - A valid open-instance handle, returned from the driver's open
+    routine DRV_I2C_Open function.
+
+  Returns:
+    None.
+
+  Example:
+    <code>
+    DRV_I2C_QueueStatisticsReset(myI2CHandle);
+    </code>
+
+  Remarks:
+    None.
+*/
+
+void DRV_I2C_QueueStatisticsReset( const DRV_HANDLE handle );
+
+// *****************************************************************************
+/* Function:
+    bool DRV_I2C_TransferStatisticsGet(
+        const DRV_HANDLE handle,
+        DRV_I2C_TRANSFER_STATISTICS* const clientStats,
+        DRV_I2C_TRANSFER_STATISTICS* const instanceStats
+    )
+
+  Summary:
+    Returns the transfer counters and latency histograms.
+
+  Description:
+    Copies the statistics of the transfers submitted by the client, and
+    those of all the transfers of the driver instance the client belongs to.
+    Either destination may be NULL.
+
+  Precondition:
+    DRV_I2C_Open must have been called to obtain a valid opened device handle.
+
+  Parameters:
+    handle - A valid open-instance handle, returned from the driver's open
+    routine DRV_I2C_Open function.
+
+    clientStats - Destination of the client statistics, or NULL.
+
+    instanceStats - Destination of the instance statistics, or NULL.
+
+  Returns:
+    true - if the statistics were copied.
+
+    false - if the handle is not valid.
+
+  Example:
+    <code>
+    DRV_I2C_TRANSFER_STATISTICS stats;
+
+    if (DRV_I2C_TransferStatisticsGet(myI2CHandle, &stats, NULL) == true)
+    {
+        // stats.busHistogram[k] transfers took 2^k to 2^(k+1) - 1 cycles
+    }
+    </code>
+
+  Remarks:
+    The copy is taken with interrupts disabled, so that it is consistent.
+*/
+
+bool DRV_I2C_TransferStatisticsGet(
+    const DRV_HANDLE handle,
+    DRV_I2C_TRANSFER_STATISTICS* const clientStats,
+    DRV_I2C_TRANSFER_STATISTICS* const instanceStats
+);
+
+// *****************************************************************************
+/* Function:
+    void DRV_I2C_TransferStatisticsReset( const DRV_HANDLE handle )
+
+  Summary:
+    Clears the transfer statistics of the client and of its driver instance.
+
+  Description:
+    Clears the counters and histograms returned by
+    DRV_I2C_TransferStatisticsGet for the client and for the driver
+    instance. The statistics of the other clients are kept.
+
+  Precondition:
+    DRV_I2C_Open must have been called to obtain a valid opened device handle.
+
+  Parameters:
+    handle - A valid open-instance handle, returned from the driver's open
+    routine DRV_I2C_Open function.
+
+  Returns:
+    None.
+
+  Example:
+    <code>
+    DRV_I2C_TransferStatisticsReset(myI2CHandle);
+    </code>
+
+  Remarks:
+    None.
+*/
+
+void DRV_I2C_TransferStatisticsReset( const DRV_HANDLE handle );
+
+// *****************************************************************************
+/* Function:
+    DRV_I2C_TRANSFER_EVENT DRV_I2C_TransferStatusGet(
+        const DRV_I2C_TRANSFER_HANDLE transferHandle
+    )
+
+  Summary:
+    Returns the status of the write/read/write-read transfer request.
+
+  Description:
+    This function can be used to poll the status of the queued transfer request
+    if the application doesn't prefer to use the event handler (callback)
+    function to get notified.
+
+  Precondition:
+    DRV_I2C_Open must have been called to obtain a valid opened device handle.
+
+    Either the DRV_I2C_ReadTransferAdd, DRV_I2C_WriteTransferAdd or
+    DRV_I2C_WriteReadTransferAdd function must have been called and a valid
+    buffer handle returned.
+
+  Parameters:
+    transferHandle - Handle for the buffer of which the processed number of
+    bytes to be obtained.
+
+  Returns:
+    The success or error event of the transfer.
 
   Example:
   <code>
@@ -1396,6 +2158,125 @@ bool DRV_I2C_WriteReadTransfer (
     const size_t readSize
 );
 
+// *****************************************************************************
+/* Function:
+    bool DRV_I2C_WriteVectorTransfer(
+        const DRV_HANDLE handle,
+        uint16_t address,
+        const DRV_I2C_SEGMENT* const segments,
+        const size_t segmentCount
+    )
+
+  Summary:
+    This is a blocking function that performs a vectored I2C write.
+
+  Description:
+    This function writes the bytes of all the segments, in order, as one bus
+    transaction and blocks until the write is complete or has failed.
+
+  Precondition:
+    DRV_I2C_Open must have been called to obtain a valid opened device handle.
+
+  Parameters:
+    handle - Handle of the communication channel as returned by the
+    DRV_I2C_Open function.
+
+    address - Slave address
+
+    segments - Array of segments to send. Segments may be empty, but not
+    all of them.
+
+    segmentCount - Number of entries in segments.
+
+  Returns:
+    true - write is successful
+    false - error has occurred
+
+  Example:
+    <code>
+    uint8_t reg = MY_REGISTER;
+    DRV_I2C_SEGMENT segments[2] = {
+        { &reg, 1 },
+        { myPayload, MY_PAYLOAD_SIZE }
+    };
+
+    if (DRV_I2C_WriteVectorTransfer(myI2CHandle, slaveAddress, segments, 2) == false)
+    {
+        // Error handling here
+    }
+    </code>
+
+  Remarks:
+    This function should not be called from an interrupt context.
+    This function is available only in the synchronous mode.
+*/
+
+bool DRV_I2C_WriteVectorTransfer(
+    const DRV_HANDLE handle,
+    uint16_t address,
+    const DRV_I2C_SEGMENT* const segments,
+    const size_t segmentCount
+);
+
+// *****************************************************************************
+/* Function:
+    bool DRV_I2C_ChainTransfer(
+        const DRV_HANDLE handle,
+        const DRV_I2C_CHAIN_TRANSFER* const chain,
+        const size_t count
+    )
+
+  Summary:
+    This is a blocking function that performs a chain of transactions.
+
+  Description:
+    This function performs the transactions of the chain, in order, and
+    blocks until the last one is complete or one has failed. Each
+    transaction is started from the completion interrupt of the previous
+    one, so the calling thread is woken only once for the whole chain.
+
+  Precondition:
+    DRV_I2C_Open must have been called to obtain a valid opened device handle.
+
+  Parameters:
+    handle - Handle of the communication channel as returned by the
+    DRV_I2C_Open function.
+
+    chain - Array of transactions.
+
+    count - Number of entries in chain.
+
+  Returns:
+    true - all the transactions are successful
+    false - error has occurred, the transactions after the failed one have
+    not been started
+
+  Example:
+    <code>
+    uint8_t clear = MY_CLEAR_COMMAND;
+    uint8_t reg = MY_DATA_REGISTER;
+    DRV_I2C_CHAIN_TRANSFER chain[2] = {
+        { slaveAddress, &reg, 1, myData, MY_DATA_SIZE },
+        { slaveAddress, &clear, 1, NULL, 0 }
+    };
+
+    if (DRV_I2C_ChainTransfer(myI2CHandle, chain, 2) == false)
+    {
+        // Error handling here
+    }
+    </code>
+
+  Remarks:
+    This function should not be called from an interrupt context.
+    This function is available only in the synchronous mode.
+*/
+
+bool DRV_I2C_ChainTransfer(
+    const DRV_HANDLE handle,
+    const DRV_I2C_CHAIN_TRANSFER* const chain,
+    const size_t count
+);
+
 // *****************************************************************************
 /* Function:
     void DRV_I2C_QueuePurge(const DRV_HANDLE handle)
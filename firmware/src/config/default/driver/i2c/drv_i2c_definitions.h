@@ -91,6 +91,32 @@ typedef struct
 
 } DRV_I2C_TRANSFER_SETUP;
 
+// *****************************************************************************
+/* I2C Driver Write Segment
+
+  Summary:
+    One buffer of a vectored write.
+
+  Description:
+    A vectored write sends the bytes of all its segments, in order, as the
+    data of a single bus transaction. This lets a register address byte and
+    a payload held elsewhere go out together without being copied into one
+    buffer first. Matches the layout of the PLib segment type.
+
+  Remarks:
+    None.
+*/
+
+typedef struct
+{
+    /* Bytes to send */
+    uint8_t*        buffer;
+
+    /* Number of bytes, may be zero */
+    uint32_t        length;
+
+} DRV_I2C_SEGMENT;
+
 // *****************************************************************************
 /* I2C Driver Error
 
@@ -115,6 +141,12 @@ typedef enum
     /* Bus Error */
     DRV_I2C_ERROR_BUS,
 
+    /* Arbitration lost to another master */
+    DRV_I2C_ERROR_ARBITRATION_LOST,
+
+    /* Transfer did not complete within the client's timeout */
+    DRV_I2C_ERROR_TIMEOUT,
+
 } DRV_I2C_ERROR;
 
 
@@ -127,8 +159,12 @@ typedef bool (* DRV_I2C_PLIB_WRITE)( uint16_t, uint8_t *, uint32_t );
 
 typedef bool (* DRV_I2C_PLIB_WRITE_READ)( uint16_t, uint8_t *, uint32_t, uint8_t *, uint32_t );
 
+typedef bool (* DRV_I2C_PLIB_WRITE_VECTOR)( uint16_t, const DRV_I2C_SEGMENT *, uint32_t );
+
 typedef void (* DRV_I2C_PLIB_TRANSFER_ABORT) (void);
 
+typedef bool (* DRV_I2C_PLIB_BUS_RECOVER) (void);
+
 typedef DRV_I2C_ERROR (* DRV_I2C_PLIB_ERROR_GET)( void );
 
 typedef bool (* DRV_I2C_PLIB_TRANSFER_SETUP)(DRV_I2C_TRANSFER_SETUP* setup, uint32_t srcClkFreq);
@@ -182,10 +218,16 @@ typedef struct
 
     /* I2C PLib writeRead API */
     DRV_I2C_PLIB_WRITE_READ                     writeRead;
+
+    /* I2C PLib vectored write API */
+    DRV_I2C_PLIB_WRITE_VECTOR                   writeVector;
     
     /* I2C PLib transfer Abort API */
     DRV_I2C_PLIB_TRANSFER_ABORT                 transferAbort;
 
+    /* I2C PLib bus clear and re-initialization API */
+    DRV_I2C_PLIB_BUS_RECOVER                    busRecover;
+
     /* I2C PLib transfer */
     DRV_I2C_PLIB_ERROR_GET                      errorGet;
 
@@ -225,9 +267,19 @@ typedef struct
     /* Number of clients */
     uint32_t                                numClients;
 
+    /* Memory Pool for Transfer Objects */
+    uintptr_t                               transferObj;
+
+    /* Number of Transfer Objects in the pool */
+    uint32_t                                queueSize;
+
     /* peripheral clock speed */
     uint32_t                                clockSpeed;
 
+    /* Default transfer timeout of a client in milliseconds, 0 waits
+     * forever */
+    uint16_t                                transferTimeout;
+
 } DRV_I2C_INIT;
 
 //DOM-IGNORE-BEGIN
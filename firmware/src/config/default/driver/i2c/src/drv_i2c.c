@@ -48,6 +48,7 @@
 #include "configuration.h"
 #include "driver/i2c/drv_i2c.h"
 #include "system/debug/sys_debug.h"
+#include <string.h>
 
 // *****************************************************************************
 // *****************************************************************************
@@ -113,454 +114,1661 @@ static DRV_I2C_CLIENT_OBJ* _DRV_I2C_DriverHandleValidate(DRV_HANDLE handle)
     return(client);
 }
 
-static void _DRV_I2C_PLibCallbackHandler( uintptr_t contextHandle )
+static bool _DRV_I2C_ChainTransferStart( DRV_I2C_OBJ* dObj, DRV_I2C_TRANSFER_OBJ* transferObj )
 {
-    DRV_I2C_OBJ* dObj = (DRV_I2C_OBJ *)contextHandle;
-    DRV_I2C_CLIENT_OBJ* clientObj = (DRV_I2C_CLIENT_OBJ*)NULL;
-
-    clientObj = (DRV_I2C_CLIENT_OBJ*)dObj->activeClient;
-
-    /* Update error into the client object*/
-    clientObj->errors = dObj->i2cPlib->errorGet();
+    const DRV_I2C_CHAIN_TRANSFER* step = &((const DRV_I2C_CHAIN_TRANSFER*)transferObj->writeBuffer)[transferObj->chainIndex];
 
-    if(clientObj->errors == DRV_I2C_ERROR_NONE)
+    if ((step->writeSize != 0) && (step->writeBuffer != NULL))
     {
-        dObj->transferStatus = DRV_I2C_TRANSFER_STATUS_COMPLETE;
+        if (step->readSize == 0)
+        {
+            return dObj->i2cPlib->write(step->address, step->writeBuffer, step->writeSize);
+        }
+
+        if (step->readBuffer != NULL)
+        {
+            return dObj->i2cPlib->writeRead(step->address, step->writeBuffer, step->writeSize, step->readBuffer, step->readSize);
+        }
     }
-    else
+    else if ((step->writeSize == 0) && (step->readSize != 0) && (step->readBuffer != NULL))
     {
-        dObj->transferStatus = DRV_I2C_TRANSFER_STATUS_ERROR;
+        return dObj->i2cPlib->read(step->address, step->readBuffer, step->readSize);
     }
 
-    /* Unblock the application thread */
-    OSAL_SEM_PostISR( &dObj->transferDone);
+    return false;
 }
 
-SYS_MODULE_OBJ DRV_I2C_Initialize( const SYS_MODULE_INDEX drvIndex, const SYS_MODULE_INIT * const init )
+static bool _DRV_I2C_TransferStart( DRV_I2C_OBJ* dObj, DRV_I2C_TRANSFER_OBJ* transferObj )
 {
-    DRV_I2C_OBJ* dObj     = (DRV_I2C_OBJ*)NULL;
-    DRV_I2C_INIT* i2cInit = (DRV_I2C_INIT*)init;
+    DRV_I2C_CLIENT_OBJ* clientObj = (DRV_I2C_CLIENT_OBJ*)transferObj->clientHandle;
+    bool isReqAccepted = false;
 
-    /* Validate the request */
-    if(drvIndex >= DRV_I2C_INSTANCES_NUMBER)
+    /* Error is cleared for every new transfer */
+    clientObj->errors = DRV_I2C_ERROR_NONE;
+
+    /* Errors if any, will be saved in the activeClient in the driver callback */
+    dObj->activeClient = (uintptr_t)clientObj;
+
+    /* Check if the transfer setup for this client is different than the current transfer setup */
+    if (dObj->currentTransferSetup.clockSpeed != clientObj->transferSetup.clockSpeed)
     {
-        SYS_DEBUG_MESSAGE(SYS_ERROR_ERROR, "Invalid driver instance");
-        return SYS_MODULE_OBJ_INVALID;
+        /* Set the new transfer setup */
+        dObj->i2cPlib->transferSetup(&clientObj->transferSetup, 0);
+
+        dObj->currentTransferSetup.clockSpeed = clientObj->transferSetup.clockSpeed;
     }
 
-    if(gDrvI2CObj[drvIndex].status == SYS_STATUS_READY)
+    switch(transferObj->flag)
     {
-        SYS_DEBUG_MESSAGE(SYS_ERROR_ERROR, "Instance already initialized");
-        return SYS_MODULE_OBJ_INVALID;
-    }
+        case DRV_I2C_TRANSFER_OBJ_FLAG_READ:
+            isReqAccepted = dObj->i2cPlib->read(transferObj->slaveAddress, transferObj->readBuffer, transferObj->readSize);
+            break;
 
-    /* Allocate the driver object */
-    dObj = &gDrvI2CObj[drvIndex];
-    dObj->inUse = true;
+        case DRV_I2C_TRANSFER_OBJ_FLAG_WRITE:
+            isReqAccepted = dObj->i2cPlib->write(transferObj->slaveAddress, transferObj->writeBuffer, transferObj->writeSize);
+            break;
 
-    /* Update the driver parameters */
-    dObj->i2cPlib                           = i2cInit->i2cPlib;
-    dObj->clientObjPool                     = i2cInit->clientObjPool;
-    dObj->nClientsMax                       = i2cInit->numClients;
-    dObj->nClients                          = 0;
-    dObj->activeClient                      = (uintptr_t)NULL;
-    dObj->i2cTokenCount                     = 1;
-    dObj->isExclusive                       = false;
-    dObj->initI2CClockSpeed                 = i2cInit->clockSpeed;
-    dObj->currentTransferSetup.clockSpeed   = i2cInit->clockSpeed;
+        case DRV_I2C_TRANSFER_OBJ_FLAG_WRITE_READ:
+            isReqAccepted = dObj->i2cPlib->writeRead(transferObj->slaveAddress, transferObj->writeBuffer, transferObj->writeSize, transferObj->readBuffer, transferObj->readSize);
+            break;
 
-    if (OSAL_MUTEX_Create(&dObj->clientMutex) == OSAL_RESULT_FALSE)
-    {
-        /*  If the mutex was not created because the memory required to
-            hold the mutex could not be allocated then NULL is returned. */
-        return SYS_MODULE_OBJ_INVALID;
-    }
+        case DRV_I2C_TRANSFER_OBJ_FLAG_WRITE_VECTOR:
+            if (dObj->i2cPlib->writeVector != NULL)
+            {
+                isReqAccepted = dObj->i2cPlib->writeVector(transferObj->slaveAddress, (const DRV_I2C_SEGMENT*)transferObj->writeBuffer, transferObj->writeSize);
+            }
+            break;
 
-    if (OSAL_MUTEX_Create(&dObj->transferMutex) == OSAL_RESULT_FALSE)
-    {
-        /*  If the mutex was not created because the memory required to
-            hold the mutex could not be allocated then NULL is returned. */
-        return SYS_MODULE_OBJ_INVALID;
+        case DRV_I2C_TRANSFER_OBJ_FLAG_CHAIN:
+            isReqAccepted = _DRV_I2C_ChainTransferStart(dObj, transferObj);
+            break;
+
+        default:
+            break;
     }
-    if (OSAL_SEM_Create(&dObj->transferDone,OSAL_SEM_TYPE_BINARY, 0, 0) == OSAL_RESULT_FALSE)
+
+    if (isReqAccepted == false)
     {
-        /* There was insufficient heap memory available for the semaphore to
-        be created successfully. */
-        return SYS_MODULE_OBJ_INVALID;
+        /* Update error into the client object*/
+        clientObj->errors = dObj->i2cPlib->errorGet();
     }
 
-    /* Register a callback with PLIB.
-     * dObj as a context parameter will be used to distinguish the events
-     * from different instances. */
-    dObj->i2cPlib->callbackRegister(_DRV_I2C_PLibCallbackHandler, (uintptr_t)dObj);
-
-    /* Update the status */
-    dObj->status = SYS_STATUS_READY;
-
-    /* Return the object structure */
-    return ( (SYS_MODULE_OBJ)drvIndex );
+    return isReqAccepted;
 }
 
-SYS_STATUS DRV_I2C_Status( const SYS_MODULE_OBJ object)
+static size_t _DRV_I2C_TransferBytes( DRV_I2C_TRANSFER_OBJ* transferObj )
 {
-    /* Validate the request */
-    if((object == SYS_MODULE_OBJ_INVALID) || (object >= DRV_I2C_INSTANCES_NUMBER))
+    const DRV_I2C_SEGMENT* segments;
+    const DRV_I2C_CHAIN_TRANSFER* chain;
+    size_t bytes = 0;
+    size_t i;
+
+    switch(transferObj->flag)
     {
-        SYS_DEBUG_MESSAGE(SYS_ERROR_ERROR, "Invalid system object handle");
-        return SYS_STATUS_UNINITIALIZED;
+        case DRV_I2C_TRANSFER_OBJ_FLAG_WRITE_VECTOR:
+            segments = (const DRV_I2C_SEGMENT*)transferObj->writeBuffer;
+            for (i = 0; i < transferObj->writeSize; i++)
+            {
+                bytes += segments[i].length;
+            }
+            break;
+
+        case DRV_I2C_TRANSFER_OBJ_FLAG_CHAIN:
+            chain = (const DRV_I2C_CHAIN_TRANSFER*)transferObj->writeBuffer;
+            for (i = 0; i < transferObj->writeSize; i++)
+            {
+                bytes += chain[i].writeSize + chain[i].readSize;
+            }
+            break;
+
+        default:
+            bytes = transferObj->writeSize + transferObj->readSize;
+            break;
     }
 
-    return (gDrvI2CObj[object].status);
+    return bytes;
 }
 
-bool DRV_I2C_TransferSetup( const DRV_HANDLE handle, DRV_I2C_TRANSFER_SETUP* setup )
+static inline void _DRV_I2C_HistogramAdd( uint32_t* histogram, uint32_t cycles )
 {
-    DRV_I2C_CLIENT_OBJ* clientObj = NULL;
+    histogram[(cycles == 0U) ? 0U : (31U - __CLZ(cycles))]++;
+}
 
-    if(setup == NULL)
+static void _DRV_I2C_TransferStatisticsUpdate(
+    DRV_I2C_TRANSFER_STATISTICS* stats,
+    DRV_I2C_TRANSFER_OBJ* transferObj,
+    DRV_I2C_ERROR errors,
+    DRV_I2C_TRANSFER_EVENT event,
+    uint32_t doneCycles
+)
+{
+    /* Called with interrupts disabled, as the transfer leaves the queue */
+    if (event == DRV_I2C_TRANSFER_EVENT_COMPLETE)
     {
-        return false;
+        stats->completed++;
+        stats->bytes += _DRV_I2C_TransferBytes(transferObj);
     }
+    else
+    {
+        switch(errors)
+        {
+            case DRV_I2C_ERROR_NACK:
+                stats->nacks++;
+                break;
 
-    /* Validate the driver handle */
-    clientObj = _DRV_I2C_DriverHandleValidate(handle);
+            case DRV_I2C_ERROR_BUS:
+                stats->busErrors++;
+                break;
 
-    if(clientObj == NULL)
-    {
-        return false;
-    }
+            case DRV_I2C_ERROR_ARBITRATION_LOST:
+                stats->arbitrationLosses++;
+                break;
 
-    /* Save the client specific transfer setup */
-    clientObj->transferSetup = *setup;
+            case DRV_I2C_ERROR_TIMEOUT:
+                stats->aborts++;
+                break;
 
-    return true;
+            default:
+                /* Not accepted by the PLIB */
+                stats->rejected++;
+                return;
+        }
+    }
+
+    _DRV_I2C_HistogramAdd(stats->waitHistogram, transferObj->startCycles - transferObj->queuedCycles);
+    _DRV_I2C_HistogramAdd(stats->busHistogram, doneCycles - transferObj->startCycles);
+    _DRV_I2C_HistogramAdd(stats->totalHistogram, doneCycles - transferObj->queuedCycles);
 }
 
-DRV_I2C_ERROR DRV_I2C_ErrorGet( const DRV_HANDLE handle )
+static void _DRV_I2C_TasksNotify( DRV_I2C_OBJ* dObj )
 {
-    DRV_I2C_CLIENT_OBJ* clientObj = NULL;
-    DRV_I2C_ERROR errors = DRV_I2C_ERROR_NONE;
-
-    /* Validate the handle */
-    clientObj = _DRV_I2C_DriverHandleValidate(handle);
+    BaseType_t higherPriorityTaskWoken = pdFALSE;
 
-    if(clientObj != NULL)
+    if (dObj->tasksTask == NULL)
     {
-        errors = clientObj->errors;
+        return;
     }
 
-    return errors;
+    /* Started from the PLIB interrupt as well as from client tasks */
+    if (__get_IPSR() != 0U)
+    {
+        vTaskNotifyGiveIndexedFromISR(dObj->tasksTask, DRV_I2C_TASKS_NOTIFY_INDEX, &higherPriorityTaskWoken);
+        portYIELD_FROM_ISR(higherPriorityTaskWoken);
+    }
+    else
+    {
+        xTaskNotifyGiveIndexed(dObj->tasksTask, DRV_I2C_TASKS_NOTIFY_INDEX);
+    }
 }
 
-DRV_HANDLE DRV_I2C_Open( const SYS_MODULE_INDEX drvIndex, const DRV_IO_INTENT ioIntent )
+static void _DRV_I2C_TransferComplete( DRV_I2C_OBJ* dObj, DRV_I2C_TRANSFER_OBJ* transferObj, DRV_I2C_TRANSFER_EVENT event )
 {
-    DRV_I2C_CLIENT_OBJ* clientObj = NULL;
-    DRV_I2C_OBJ* dObj = NULL;
-    uint32_t iClient;
+    DRV_I2C_CLIENT_OBJ* clientObj = (DRV_I2C_CLIENT_OBJ*)transferObj->clientHandle;
+    uint32_t doneCycles = DWT->CYCCNT;
+    bool intState, busIdle;
+#if (DRV_I2C_SYNC_TASK_NOTIFY == 1)
+    BaseType_t higherPriorityTaskWoken = pdFALSE;
+#endif
 
-    /* Validate the request */
-    if (drvIndex >= DRV_I2C_INSTANCES_NUMBER)
-    {
-        SYS_DEBUG_MESSAGE(SYS_ERROR_ERROR, "Invalid Driver Instance");
-        return DRV_HANDLE_INVALID;
-    }
+    /* Retire the transfer from the head of the queue */
+    intState = SYS_INT_Disable();
 
-    dObj = &gDrvI2CObj[drvIndex];
+    _DRV_I2C_TransferStatisticsUpdate(&clientObj->transferStats, transferObj, clientObj->errors, event, doneCycles);
+    _DRV_I2C_TransferStatisticsUpdate(&dObj->transferStats, transferObj, clientObj->errors, event, doneCycles);
 
-    if((dObj->status != SYS_STATUS_READY) || (dObj->inUse == false))
-    {
-        SYS_DEBUG_MESSAGE(SYS_ERROR_ERROR, "Was the driver initialized?");
-        return DRV_HANDLE_INVALID;
-    }
+    dObj->transferQueueHead = transferObj->next;
 
-    /* Acquire the instance specific mutex to protect the instance specific
-     * client pool
-     */
-    if (OSAL_MUTEX_Lock(&dObj->clientMutex , OSAL_WAIT_FOREVER ) == OSAL_RESULT_FALSE)
+    if (dObj->transferQueueHead == NULL)
     {
-        return DRV_HANDLE_INVALID;
+        dObj->transferQueueTail = NULL;
     }
 
-    if(dObj->isExclusive)
+    dObj->activeTransfer = NULL;
+
+    dObj->queueStats.queueDepth--;
+
+    busIdle = (dObj->transferQueueHead == NULL);
+
+    SYS_INT_Restore(intState);
+
+    /* The deadline the driver task is blocked on no longer applies */
+    if (busIdle == true)
     {
-        /* This means the another client has opened the driver in exclusive
-           mode. The driver cannot be opened again
-        */
-        OSAL_MUTEX_Unlock( &dObj->clientMutex);
-        return DRV_HANDLE_INVALID;
+        _DRV_I2C_TasksNotify(dObj);
     }
 
-    if((dObj->nClients > 0) && (ioIntent & DRV_IO_INTENT_EXCLUSIVE))
+    transferObj->event = event;
+
+    if (transferObj == &dObj->syncTransferObj)
     {
-        /* This means the driver was already opened and another driver was
-           trying to open it exclusively.  We cannot give exclusive access in
-           this case
-        */
-        OSAL_MUTEX_Unlock( &dObj->clientMutex);
-        return(DRV_HANDLE_INVALID);
-    }
+        dObj->transferStatus = (event == DRV_I2C_TRANSFER_EVENT_COMPLETE) ?
+            DRV_I2C_TRANSFER_STATUS_COMPLETE : DRV_I2C_TRANSFER_STATUS_ERROR;
 
-    /* Enter here only if the lock was obtained */
-    for(iClient = 0; iClient != dObj->nClientsMax; iClient++)
+        dObj->transferDoneCycles = DWT->CYCCNT;
+        dObj->transferDoneFromISR = (__get_IPSR() != 0U);
+
+        /* Unblock the application thread. Retired from the PLIB interrupt,
+         * or from a task by the timeout check */
+        if (__get_IPSR() != 0U)
+        {
+#if (DRV_I2C_SYNC_TASK_NOTIFY == 1)
+            vTaskNotifyGiveIndexedFromISR(dObj->transferTask, DRV_I2C_SYNC_NOTIFY_INDEX, &higherPriorityTaskWoken);
+            portYIELD_FROM_ISR(higherPriorityTaskWoken);
+#else
+            OSAL_SEM_PostISR( &dObj->transferDone);
+#endif
+        }
+        else
+        {
+#if (DRV_I2C_SYNC_TASK_NOTIFY == 1)
+            xTaskNotifyGiveIndexed(dObj->transferTask, DRV_I2C_SYNC_NOTIFY_INDEX);
+#else
+            OSAL_SEM_Post( &dObj->transferDone);
+#endif
+        }
+    }
+    else
     {
-        if(false == ((DRV_I2C_CLIENT_OBJ *)dObj->clientObjPool)[iClient].inUse)
+        if (clientObj->eventHandler != NULL)
         {
-            /* This means we have a free client object to use */
-            clientObj = &((DRV_I2C_CLIENT_OBJ *)dObj->clientObjPool)[iClient];
+            clientObj->eventHandler(event, transferObj->transferHandle, clientObj->context);
+        }
 
-            clientObj->inUse        = true;
+        /* The transfer handle expires once the client has been notified */
+        transferObj->inUse = false;
+    }
+}
 
-            clientObj->hDriver      = dObj;
+static void _DRV_I2C_WaitTimeUpdate( DRV_I2C_OBJ* dObj, DRV_I2C_TRANSFER_OBJ* transferObj )
+{
+    uint32_t waitCycles = DWT->CYCCNT - transferObj->queuedCycles;
 
-            clientObj->ioIntent     = ioIntent;
+    /* Called with interrupts disabled, as the transfer leaves the queue */
+    dObj->queueStats.transfers[transferObj->priority]++;
+    dObj->queueStats.waitCycles[transferObj->priority] += waitCycles;
 
-            clientObj->errors       = DRV_I2C_ERROR_NONE;
+    if (waitCycles > dObj->queueStats.waitCyclesMax[transferObj->priority])
+    {
+        dObj->queueStats.waitCyclesMax[transferObj->priority] = waitCycles;
+    }
+}
 
-            clientObj->transferSetup.clockSpeed = dObj->initI2CClockSpeed;
+static void _DRV_I2C_TransferProcessNext( DRV_I2C_OBJ* dObj )
+{
+    DRV_I2C_TRANSFER_OBJ* transferObj;
+    bool intState;
 
-            if(ioIntent & DRV_IO_INTENT_EXCLUSIVE)
-            {
-                /* Set the driver exclusive flag */
-                dObj->isExclusive = true;
-            }
+    while (true)
+    {
+        /* Claim the head of the queue if the bus is free and not taken over */
+        intState = SYS_INT_Disable();
 
-            dObj->nClients ++;
+        transferObj = NULL;
 
-            /* Save the generated client handle in the client object, which will
-             * be then used to verify the validity of the client handle.
-             */
-            clientObj->clientHandle = _DRV_I2C_MAKE_HANDLE(dObj->i2cTokenCount, drvIndex, iClient);
+        if ((dObj->activeTransfer == NULL) && (dObj->transferQueueHead != NULL) && (dObj->busOwner == 0U))
+        {
+            transferObj = dObj->transferQueueHead;
+            dObj->activeTransfer = transferObj;
+            dObj->activeStartTick = xTaskGetTickCountFromISR();
+            transferObj->startCycles = DWT->CYCCNT;
 
-            /* Increment the instance specific token counter */
-            dObj->i2cTokenCount = _DRV_I2C_UPDATE_TOKEN(dObj->i2cTokenCount);
+            _DRV_I2C_WaitTimeUpdate(dObj, transferObj);
+        }
+
+        SYS_INT_Restore(intState);
 
+        if (transferObj == NULL)
+        {
             break;
         }
-    }
 
-    OSAL_MUTEX_Unlock(&dObj->clientMutex);
+        /* The timeout of this transfer is now running */
+        _DRV_I2C_TasksNotify(dObj);
 
-    return clientObj ? ((DRV_HANDLE)clientObj->clientHandle) : DRV_HANDLE_INVALID;
+        if (_DRV_I2C_TransferStart(dObj, transferObj) == true)
+        {
+            /* Completion is reported by the PLIB callback */
+            break;
+        }
+
+        /* The PLIB rejected the request, retire it and try the next one */
+        _DRV_I2C_TransferComplete(dObj, transferObj, DRV_I2C_TRANSFER_EVENT_ERROR);
+    }
 }
 
-void DRV_I2C_Close( const DRV_HANDLE handle )
+static void _DRV_I2C_TransferQueue( DRV_I2C_OBJ* dObj, DRV_I2C_TRANSFER_OBJ* transferObj )
 {
-    /* This function closes the client, The client
-       object is deallocated and returned to the
-       pool.
-    */
-
-    DRV_I2C_CLIENT_OBJ* clientObj;
-    DRV_I2C_OBJ* dObj;
+    DRV_I2C_CLIENT_OBJ* clientObj = (DRV_I2C_CLIENT_OBJ*)transferObj->clientHandle;
+    DRV_I2C_TRANSFER_OBJ* prev = NULL;
+    DRV_I2C_TRANSFER_OBJ* cur;
+    bool intState;
 
-    /* Validate the handle */
-    clientObj = _DRV_I2C_DriverHandleValidate(handle);
+    transferObj->event = DRV_I2C_TRANSFER_EVENT_PENDING;
+    transferObj->priority = clientObj->priority;
+    transferObj->chainIndex = 0;
 
-    if(clientObj != NULL)
-    {
-        dObj = (DRV_I2C_OBJ*)clientObj->hDriver;
+    intState = SYS_INT_Disable();
 
-        /* Acquire the instance specific mutex to protect the instance specific
-         * client pool
-         */
-        if (OSAL_MUTEX_Lock(&dObj->clientMutex , OSAL_WAIT_FOREVER ) == OSAL_RESULT_TRUE)
-        {
-            /* Reduce the number of clients */
-            dObj->nClients --;
+    transferObj->queuedCycles = DWT->CYCCNT;
 
-            /* Reset the exclusive flag */
-            dObj->isExclusive = false;
+    /* The transfer on the bus stays at the head */
+    cur = dObj->transferQueueHead;
 
-            /* De-allocate the object */
-            clientObj->inUse = false;
+    if ((cur != NULL) && (cur == dObj->activeTransfer))
+    {
+        prev = cur;
+        cur = cur->next;
+    }
 
-            /* Release the instance specific mutex */
-            OSAL_MUTEX_Unlock( &dObj->clientMutex );
-        }
+    /* Behind every transfer of the same or higher priority */
+    while ((cur != NULL) && (cur->priority >= transferObj->priority))
+    {
+        prev = cur;
+        cur = cur->next;
     }
-}
+
+    transferObj->next = cur;
+
+    if (prev == NULL)
+    {
+        dObj->transferQueueHead = transferObj;
+    }
+    else
+    {
+        prev->next = transferObj;
+    }
+
+    if (cur == NULL)
+    {
+        dObj->transferQueueTail = transferObj;
+    }
+    else
+    {
+        dObj->queueStats.overtakes++;
+    }
+
+    dObj->queueStats.queueDepth++;
+
+    if (dObj->queueStats.queueDepth > dObj->queueStats.queueDepthMax)
+    {
+        dObj->queueStats.queueDepthMax = dObj->queueStats.queueDepth;
+    }
+
+    SYS_INT_Restore(intState);
+
+    _DRV_I2C_TransferProcessNext(dObj);
+}
+
+static void _DRV_I2C_WakeTimeUpdate( DRV_I2C_OBJ* dObj )
+{
+    uint32_t wakeCycles = DWT->CYCCNT - dObj->transferDoneCycles;
+    bool intState;
+
+    intState = SYS_INT_Disable();
+
+    dObj->queueStats.syncWakeups++;
+    dObj->queueStats.syncWakeCycles += wakeCycles;
+
+    if (wakeCycles > dObj->queueStats.syncWakeCyclesMax)
+    {
+        dObj->queueStats.syncWakeCyclesMax = wakeCycles;
+    }
+
+    SYS_INT_Restore(intState);
+}
+
+static void _DRV_I2C_TimeoutCountUpdate( DRV_I2C_OBJ* dObj )
+{
+    bool intState;
+
+    intState = SYS_INT_Disable();
+
+    dObj->queueStats.timeouts++;
+
+    SYS_INT_Restore(intState);
+}
+
+static void _DRV_I2C_TransferTimeoutCheck( DRV_I2C_OBJ* dObj )
+{
+    DRV_I2C_TRANSFER_OBJ* transferObj;
+    DRV_I2C_CLIENT_OBJ* clientObj = NULL;
+    bool busReleased = true;
+    bool intState;
+
+    /* Claim the active transfer if it has outlived its client's timeout */
+    intState = SYS_INT_Disable();
+
+    transferObj = dObj->activeTransfer;
+
+    /* A client owning the peripheral drives it without the driver */
+    if ((transferObj == NULL) || (dObj->busRecovering == true) || (dObj->busOwned == true))
+    {
+        transferObj = NULL;
+    }
+    else
+    {
+        clientObj = (DRV_I2C_CLIENT_OBJ*)transferObj->clientHandle;
+
+        if ((clientObj->transferTimeout == 0U) ||
+            ((xTaskGetTickCountFromISR() - dObj->activeStartTick) < pdMS_TO_TICKS(clientObj->transferTimeout)))
+        {
+            transferObj = NULL;
+        }
+        else
+        {
+            /* Stop the PLIB before it can complete the transfer on its own */
+            dObj->i2cPlib->transferAbort();
+            dObj->busRecovering = true;
+        }
+    }
+
+    SYS_INT_Restore(intState);
+
+    if (transferObj == NULL)
+    {
+        return;
+    }
+
+    /* A slave holding SDA low is clocked out of its byte, the bus is
+     * released with a STOP and the peripheral re-initialized */
+    if (dObj->i2cPlib->busRecover != NULL)
+    {
+        busReleased = dObj->i2cPlib->busRecover();
+    }
+
+    /* The baud rate is reprogrammed by the next transfer */
+    dObj->currentTransferSetup.clockSpeed = 0;
+
+    intState = SYS_INT_Disable();
+
+    dObj->queueStats.timeouts++;
+
+    if (busReleased == true)
+    {
+        dObj->queueStats.busRecoveries++;
+    }
+    else
+    {
+        dObj->queueStats.busRecoveryFailures++;
+    }
+
+    SYS_INT_Restore(intState);
+
+    clientObj->errors = DRV_I2C_ERROR_TIMEOUT;
+
+    _DRV_I2C_TransferComplete(dObj, transferObj, DRV_I2C_TRANSFER_EVENT_ERROR);
+
+    dObj->busRecovering = false;
+
+    _DRV_I2C_TransferProcessNext(dObj);
+}
+
+static bool _DRV_I2C_SyncTransferExpire( DRV_I2C_OBJ* dObj, DRV_I2C_TRANSFER_OBJ* transferObj, TickType_t queuedTick, uint16_t waitMS )
+{
+    DRV_I2C_CLIENT_OBJ* clientObj = (DRV_I2C_CLIENT_OBJ*)transferObj->clientHandle;
+    DRV_I2C_TRANSFER_OBJ* prev = NULL;
+    DRV_I2C_TRANSFER_OBJ* cur;
+    bool intState;
+
+    if ((waitMS == OSAL_WAIT_FOREVER) || ((xTaskGetTickCount() - queuedTick) < pdMS_TO_TICKS(waitMS)))
+    {
+        return false;
+    }
+
+    intState = SYS_INT_Disable();
+
+    /* Once on the bus the transfer is retired by the timeout check */
+    cur = dObj->transferQueueHead;
+
+    while ((cur != NULL) && (cur != transferObj))
+    {
+        prev = cur;
+        cur = cur->next;
+    }
+
+    if ((cur == NULL) || (cur == dObj->activeTransfer))
+    {
+        SYS_INT_Restore(intState);
+        return false;
+    }
+
+    /* Still waiting behind other transfers or an owner of the bus */
+    if (prev == NULL)
+    {
+        dObj->transferQueueHead = transferObj->next;
+    }
+    else
+    {
+        prev->next = transferObj->next;
+    }
+
+    if (dObj->transferQueueTail == transferObj)
+    {
+        dObj->transferQueueTail = prev;
+    }
+
+    dObj->queueStats.queueDepth--;
+    dObj->queueStats.timeouts++;
+
+    SYS_INT_Restore(intState);
+
+    transferObj->event = DRV_I2C_TRANSFER_EVENT_ERROR;
+    dObj->transferStatus = DRV_I2C_TRANSFER_STATUS_ERROR;
+    clientObj->errors = DRV_I2C_ERROR_TIMEOUT;
+
+    return true;
+}
+
+#if (DRV_I2C_SYNC_TASK_NOTIFY == 1)
+static bool _DRV_I2C_SyncTransferTryReserve( DRV_I2C_OBJ* dObj, bool singleClientOnly )
+{
+    bool reserved = false;
+    bool intState;
+
+    intState = SYS_INT_Disable();
+
+    if ((dObj->syncTransferBusy == false) && ((singleClientOnly == false) || (dObj->nClients == 1)))
+    {
+        dObj->syncTransferBusy = true;
+        reserved = true;
+    }
+
+    SYS_INT_Restore(intState);
+
+    return reserved;
+}
+
+static bool _DRV_I2C_SyncTransferReserve( DRV_I2C_OBJ* dObj, uint16_t waitMS, bool* mutexLocked )
+{
+    TickType_t startTick = xTaskGetTickCount();
+
+    *mutexLocked = false;
+
+    /* With a single client open there is no other thread to serialize
+     * against, the blocking transfer object is claimed without the mutex */
+    if (_DRV_I2C_SyncTransferTryReserve(dObj, true) == true)
+    {
+        return true;
+    }
+
+    if (OSAL_MUTEX_Lock(&dObj->transferMutex, waitMS ) == OSAL_RESULT_FALSE)
+    {
+        return false;
+    }
+
+    /* A transfer started without the mutex, just before another client was
+     * opened, may still be using the transfer object. It is waited for
+     * within what is left of waitMS */
+    while (_DRV_I2C_SyncTransferTryReserve(dObj, false) == false)
+    {
+        if ((waitMS != OSAL_WAIT_FOREVER) && ((xTaskGetTickCount() - startTick) >= pdMS_TO_TICKS(waitMS)))
+        {
+            OSAL_MUTEX_Unlock(&dObj->transferMutex);
+            return false;
+        }
+
+        vTaskDelay(1);
+    }
+
+    *mutexLocked = true;
+
+    return true;
+}
+
+static void _DRV_I2C_SyncTransferRelease( DRV_I2C_OBJ* dObj, bool mutexLocked )
+{
+    dObj->syncTransferBusy = false;
+
+    if (mutexLocked == true)
+    {
+        OSAL_MUTEX_Unlock(&dObj->transferMutex);
+    }
+}
+#endif
+
+static void _DRV_I2C_PLibCallbackHandler( uintptr_t contextHandle )
+{
+    DRV_I2C_OBJ* dObj = (DRV_I2C_OBJ *)contextHandle;
+    DRV_I2C_CLIENT_OBJ* clientObj = (DRV_I2C_CLIENT_OBJ*)NULL;
+    DRV_I2C_TRANSFER_OBJ* transferObj = dObj->activeTransfer;
+    DRV_I2C_TRANSFER_EVENT event;
+
+    /* The transfer is being retired by the timeout handling */
+    if (dObj->busRecovering == true)
+    {
+        return;
+    }
+
+    clientObj = (DRV_I2C_CLIENT_OBJ*)dObj->activeClient;
+
+    /* Update error into the client object*/
+    clientObj->errors = dObj->i2cPlib->errorGet();
+
+    event = (clientObj->errors == DRV_I2C_ERROR_NONE) ?
+        DRV_I2C_TRANSFER_EVENT_COMPLETE : DRV_I2C_TRANSFER_EVENT_ERROR;
+
+    /* The next transaction of a chain goes on the bus without leaving the
+     * interrupt, the chain stays at the head of the queue */
+    if ((transferObj != NULL) && (transferObj->flag == DRV_I2C_TRANSFER_OBJ_FLAG_CHAIN) &&
+        (event == DRV_I2C_TRANSFER_EVENT_COMPLETE) && (++transferObj->chainIndex < transferObj->writeSize))
+    {
+        dObj->activeStartTick = xTaskGetTickCountFromISR();
+
+        if (_DRV_I2C_ChainTransferStart(dObj, transferObj) == true)
+        {
+            dObj->queueStats.chainSteps++;
+            return;
+        }
+
+        /* Rejected by the PLIB, the chain ends here */
+        clientObj->errors = dObj->i2cPlib->errorGet();
+        event = DRV_I2C_TRANSFER_EVENT_ERROR;
+    }
+
+    if (transferObj != NULL)
+    {
+        _DRV_I2C_TransferComplete(dObj, transferObj, event);
+    }
+
+    /* Start the next queued transfer, if any */
+    _DRV_I2C_TransferProcessNext(dObj);
+}
+
+SYS_MODULE_OBJ DRV_I2C_Initialize( const SYS_MODULE_INDEX drvIndex, const SYS_MODULE_INIT * const init )
+{
+    DRV_I2C_OBJ* dObj     = (DRV_I2C_OBJ*)NULL;
+    DRV_I2C_INIT* i2cInit = (DRV_I2C_INIT*)init;
+
+    /* Validate the request */
+    if(drvIndex >= DRV_I2C_INSTANCES_NUMBER)
+    {
+        SYS_DEBUG_MESSAGE(SYS_ERROR_ERROR, "Invalid driver instance");
+        return SYS_MODULE_OBJ_INVALID;
+    }
+
+    if(gDrvI2CObj[drvIndex].status == SYS_STATUS_READY)
+    {
+        SYS_DEBUG_MESSAGE(SYS_ERROR_ERROR, "Instance already initialized");
+        return SYS_MODULE_OBJ_INVALID;
+    }
+
+    /* Allocate the driver object */
+    dObj = &gDrvI2CObj[drvIndex];
+    dObj->inUse = true;
+
+    /* Update the driver parameters */
+    dObj->i2cPlib                           = i2cInit->i2cPlib;
+    dObj->clientObjPool                     = i2cInit->clientObjPool;
+    dObj->nClientsMax                       = i2cInit->numClients;
+    dObj->nClients                          = 0;
+    dObj->activeClient                      = (uintptr_t)NULL;
+    dObj->i2cTokenCount                     = 1;
+    dObj->isExclusive                       = false;
+    dObj->initI2CClockSpeed                 = i2cInit->clockSpeed;
+    dObj->currentTransferSetup.clockSpeed   = i2cInit->clockSpeed;
+    dObj->transferObjPool                   = (DRV_I2C_TRANSFER_OBJ*)i2cInit->transferObj;
+    dObj->transferObjPoolSize               = i2cInit->queueSize;
+    dObj->transferTokenCount                = 1;
+    dObj->transferQueueHead                 = NULL;
+    dObj->transferQueueTail                 = NULL;
+    dObj->activeTransfer                    = NULL;
+    dObj->activeStartTick                   = 0;
+    dObj->busRecovering                     = false;
+    dObj->busOwner                          = 0U;
+    dObj->busOwned                          = false;
+    dObj->tasksTask                         = NULL;
+    dObj->initTransferTimeout               = i2cInit->transferTimeout;
+
+    memset(&dObj->queueStats, 0, sizeof(dObj->queueStats));
+    memset(&dObj->transferStats, 0, sizeof(dObj->transferStats));
+
+    /* Queue wait times are measured with the DWT cycle counter */
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    if (OSAL_MUTEX_Create(&dObj->clientMutex) == OSAL_RESULT_FALSE)
+    {
+        /*  If the mutex was not created because the memory required to
+            hold the mutex could not be allocated then NULL is returned. */
+        return SYS_MODULE_OBJ_INVALID;
+    }
+
+    if (OSAL_MUTEX_Create(&dObj->transferMutex) == OSAL_RESULT_FALSE)
+    {
+        /*  If the mutex was not created because the memory required to
+            hold the mutex could not be allocated then NULL is returned. */
+        return SYS_MODULE_OBJ_INVALID;
+    }
+#if (DRV_I2C_SYNC_TASK_NOTIFY == 1)
+    /* Blocking transfers wake the calling task with a direct notification */
+    dObj->transferTask                      = NULL;
+    dObj->syncTransferBusy                  = false;
+#else
+    if (OSAL_SEM_Create(&dObj->transferDone,OSAL_SEM_TYPE_BINARY, 0, 0) == OSAL_RESULT_FALSE)
+    {
+        /* There was insufficient heap memory available for the semaphore to
+        be created successfully. */
+        return SYS_MODULE_OBJ_INVALID;
+    }
+#endif
+
+    /* Register a callback with PLIB.
+     * dObj as a context parameter will be used to distinguish the events
+     * from different instances. */
+    dObj->i2cPlib->callbackRegister(_DRV_I2C_PLibCallbackHandler, (uintptr_t)dObj);
+
+    /* Update the status */
+    dObj->status = SYS_STATUS_READY;
+
+    /* Return the object structure */
+    return ( (SYS_MODULE_OBJ)drvIndex );
+}
+
+SYS_STATUS DRV_I2C_Status( const SYS_MODULE_OBJ object)
+{
+    /* Validate the request */
+    if((object == SYS_MODULE_OBJ_INVALID) || (object >= DRV_I2C_INSTANCES_NUMBER))
+    {
+        SYS_DEBUG_MESSAGE(SYS_ERROR_ERROR, "Invalid system object handle");
+        return SYS_STATUS_UNINITIALIZED;
+    }
+
+    return (gDrvI2CObj[object].status);
+}
+
+void DRV_I2C_Tasks( const SYS_MODULE_OBJ object )
+{
+    /* Validate the request */
+    if((object == SYS_MODULE_OBJ_INVALID) || (object >= DRV_I2C_INSTANCES_NUMBER))
+    {
+        SYS_DEBUG_MESSAGE(SYS_ERROR_ERROR, "Invalid system object handle");
+        return;
+    }
+
+    if (gDrvI2CObj[object].status == SYS_STATUS_READY)
+    {
+        /* Woken from here on when a transfer starts, see DRV_I2C_TasksWaitTicks */
+        if (xTaskGetSchedulerState() != taskSCHEDULER_NOT_STARTED)
+        {
+            gDrvI2CObj[object].tasksTask = xTaskGetCurrentTaskHandle();
+        }
+
+        _DRV_I2C_TransferTimeoutCheck(&gDrvI2CObj[object]);
+    }
+}
+
+uint32_t DRV_I2C_TasksWaitTicks( const SYS_MODULE_OBJ object )
+{
+    DRV_I2C_OBJ* dObj;
+    DRV_I2C_CLIENT_OBJ* clientObj;
+    uint32_t waitTicks = portMAX_DELAY;
+    TickType_t elapsed, timeout;
+    bool intState;
+
+    /* Validate the request */
+    if((object == SYS_MODULE_OBJ_INVALID) || (object >= DRV_I2C_INSTANCES_NUMBER))
+    {
+        SYS_DEBUG_MESSAGE(SYS_ERROR_ERROR, "Invalid system object handle");
+        return waitTicks;
+    }
+
+    dObj = &gDrvI2CObj[object];
+
+    intState = SYS_INT_Disable();
+
+    /* Nothing can time out while the bus is idle */
+    if ((dObj->activeTransfer != NULL) && (dObj->busRecovering == false))
+    {
+        clientObj = (DRV_I2C_CLIENT_OBJ*)dObj->activeTransfer->clientHandle;
+
+        if (clientObj->transferTimeout != 0U)
+        {
+            elapsed = xTaskGetTickCountFromISR() - dObj->activeStartTick;
+            timeout = pdMS_TO_TICKS(clientObj->transferTimeout);
+            waitTicks = (elapsed < timeout) ? (timeout - elapsed) : 0U;
+        }
+    }
+
+    SYS_INT_Restore(intState);
+
+    return waitTicks;
+}
+
+bool DRV_I2C_TransferSetup( const DRV_HANDLE handle, DRV_I2C_TRANSFER_SETUP* setup )
+{
+    DRV_I2C_CLIENT_OBJ* clientObj = NULL;
+
+    if(setup == NULL)
+    {
+        return false;
+    }
+
+    /* Validate the driver handle */
+    clientObj = _DRV_I2C_DriverHandleValidate(handle);
+
+    if(clientObj == NULL)
+    {
+        return false;
+    }
+
+    /* Save the client specific transfer setup */
+    clientObj->transferSetup = *setup;
+
+    return true;
+}
+
+DRV_I2C_ERROR DRV_I2C_ErrorGet( const DRV_HANDLE handle )
+{
+    DRV_I2C_CLIENT_OBJ* clientObj = NULL;
+    DRV_I2C_ERROR errors = DRV_I2C_ERROR_NONE;
+
+    /* Validate the handle */
+    clientObj = _DRV_I2C_DriverHandleValidate(handle);
+
+    if(clientObj != NULL)
+    {
+        errors = clientObj->errors;
+    }
+
+    return errors;
+}
+
+DRV_HANDLE DRV_I2C_Open( const SYS_MODULE_INDEX drvIndex, const DRV_IO_INTENT ioIntent )
+{
+    DRV_I2C_CLIENT_OBJ* clientObj = NULL;
+    DRV_I2C_OBJ* dObj = NULL;
+    uint32_t iClient;
+
+    /* Validate the request */
+    if (drvIndex >= DRV_I2C_INSTANCES_NUMBER)
+    {
+        SYS_DEBUG_MESSAGE(SYS_ERROR_ERROR, "Invalid Driver Instance");
+        return DRV_HANDLE_INVALID;
+    }
+
+    dObj = &gDrvI2CObj[drvIndex];
+
+    if((dObj->status != SYS_STATUS_READY) || (dObj->inUse == false))
+    {
+        SYS_DEBUG_MESSAGE(SYS_ERROR_ERROR, "Was the driver initialized?");
+        return DRV_HANDLE_INVALID;
+    }
+
+    /* Acquire the instance specific mutex to protect the instance specific
+     * client pool
+     */
+    if (OSAL_MUTEX_Lock(&dObj->clientMutex , OSAL_WAIT_FOREVER ) == OSAL_RESULT_FALSE)
+    {
+        return DRV_HANDLE_INVALID;
+    }
+
+    if(dObj->isExclusive)
+    {
+        /* This means the another client has opened the driver in exclusive
+           mode. The driver cannot be opened again
+        */
+        OSAL_MUTEX_Unlock( &dObj->clientMutex);
+        return DRV_HANDLE_INVALID;
+    }
+
+    if((dObj->nClients > 0) && (ioIntent & DRV_IO_INTENT_EXCLUSIVE))
+    {
+        /* This means the driver was already opened and another driver was
+           trying to open it exclusively.  We cannot give exclusive access in
+           this case
+        */
+        OSAL_MUTEX_Unlock( &dObj->clientMutex);
+        return(DRV_HANDLE_INVALID);
+    }
+
+    /* Enter here only if the lock was obtained */
+    for(iClient = 0; iClient != dObj->nClientsMax; iClient++)
+    {
+        if(false == ((DRV_I2C_CLIENT_OBJ *)dObj->clientObjPool)[iClient].inUse)
+        {
+            /* This means we have a free client object to use */
+            clientObj = &((DRV_I2C_CLIENT_OBJ *)dObj->clientObjPool)[iClient];
+
+            clientObj->inUse        = true;
+
+            clientObj->hDriver      = dObj;
+
+            clientObj->ioIntent     = ioIntent;
+
+            clientObj->errors       = DRV_I2C_ERROR_NONE;
+
+            clientObj->transferSetup.clockSpeed = dObj->initI2CClockSpeed;
+
+            clientObj->eventHandler = NULL;
+
+            clientObj->context      = (uintptr_t)NULL;
+
+            clientObj->priority     = DRV_I2C_TRANSFER_PRIORITY_NORMAL;
+
+            clientObj->transferTimeout = dObj->initTransferTimeout;
+
+            memset(&clientObj->transferStats, 0, sizeof(clientObj->transferStats));
+
+            if(ioIntent & DRV_IO_INTENT_EXCLUSIVE)
+            {
+                /* Set the driver exclusive flag */
+                dObj->isExclusive = true;
+            }
+
+            dObj->nClients ++;
+
+            /* Save the generated client handle in the client object, which will
+             * be then used to verify the validity of the client handle.
+             */
+            clientObj->clientHandle = _DRV_I2C_MAKE_HANDLE(dObj->i2cTokenCount, drvIndex, iClient);
+
+            /* Increment the instance specific token counter */
+            dObj->i2cTokenCount = _DRV_I2C_UPDATE_TOKEN(dObj->i2cTokenCount);
+
+            break;
+        }
+    }
+
+    OSAL_MUTEX_Unlock(&dObj->clientMutex);
+
+    return clientObj ? ((DRV_HANDLE)clientObj->clientHandle) : DRV_HANDLE_INVALID;
+}
+
+void DRV_I2C_Close( const DRV_HANDLE handle )
+{
+    /* This function closes the client, The client
+       object is deallocated and returned to the
+       pool.
+    */
+
+    DRV_I2C_CLIENT_OBJ* clientObj;
+    DRV_I2C_OBJ* dObj;
+
+    /* Validate the handle */
+    clientObj = _DRV_I2C_DriverHandleValidate(handle);
+
+    if(clientObj != NULL)
+    {
+        dObj = (DRV_I2C_OBJ*)clientObj->hDriver;
+
+        /* Acquire the instance specific mutex to protect the instance specific
+         * client pool
+         */
+        if (OSAL_MUTEX_Lock(&dObj->clientMutex , OSAL_WAIT_FOREVER ) == OSAL_RESULT_TRUE)
+        {
+            /* Reduce the number of clients */
+            dObj->nClients --;
+
+            /* Reset the exclusive flag */
+            dObj->isExclusive = false;
+
+            /* De-allocate the object */
+            clientObj->inUse = false;
+
+            /* Release the instance specific mutex */
+            OSAL_MUTEX_Unlock( &dObj->clientMutex );
+        }
+    }
+}
 
 static bool _DRV_I2C_WriteReadTransfer (
     const DRV_HANDLE handle,
-    uint16_t address,
-    void* const writeBuffer,
+    uint16_t address,
+    void* const writeBuffer,
+    const size_t writeSize,
+    void* const readBuffer,
+    const size_t readSize,
+    DRV_I2C_TRANSFER_OBJ_FLAGS transferFlags
+)
+{
+    DRV_I2C_CLIENT_OBJ* clientObj = (DRV_I2C_CLIENT_OBJ *)NULL;
+    DRV_I2C_OBJ* hDriver = (DRV_I2C_OBJ*)NULL;
+    DRV_I2C_TRANSFER_OBJ* transferObj = (DRV_I2C_TRANSFER_OBJ*)NULL;
+    bool isSuccess = false;
+    bool woken;
+    uint16_t waitMS;
+    TickType_t queuedTick;
+#if (DRV_I2C_SYNC_TASK_NOTIFY == 1)
+    bool mutexLocked;
+#endif
+
+    /* Validate the driver handle */
+    clientObj = _DRV_I2C_DriverHandleValidate(handle);
+
+    if (clientObj == NULL)
+    {
+        return isSuccess;
+    }
+
+    if (transferFlags == DRV_I2C_TRANSFER_OBJ_FLAG_READ)
+    {
+        if((readSize == 0) || (readBuffer == NULL))
+        {
+            return isSuccess;
+        }
+    }
+    else if ((transferFlags == DRV_I2C_TRANSFER_OBJ_FLAG_WRITE) || (transferFlags == DRV_I2C_TRANSFER_OBJ_FLAG_WRITE_FORCED) ||
+             (transferFlags == DRV_I2C_TRANSFER_OBJ_FLAG_WRITE_VECTOR) || (transferFlags == DRV_I2C_TRANSFER_OBJ_FLAG_CHAIN))
+    {
+        if((writeSize == 0) || (writeBuffer == NULL))
+        {
+            return isSuccess;
+        }
+    }
+    else
+    {
+        if((writeSize == 0) || (writeBuffer == NULL) || (readSize == 0) || (readBuffer == NULL))
+        {
+            return isSuccess;
+        }
+    }
+
+    hDriver = clientObj->hDriver;
+
+    waitMS = (clientObj->transferTimeout == 0U) ? OSAL_WAIT_FOREVER : clientObj->transferTimeout;
+
+    /* Block other threads from using the blocking transfer object */
+#if (DRV_I2C_SYNC_TASK_NOTIFY == 1)
+    if (_DRV_I2C_SyncTransferReserve(hDriver, waitMS, &mutexLocked) == false)
+#else
+    if (OSAL_MUTEX_Lock(&hDriver->transferMutex, waitMS ) == OSAL_RESULT_FALSE)
+#endif
+    {
+        clientObj->errors = DRV_I2C_ERROR_TIMEOUT;
+        _DRV_I2C_TimeoutCountUpdate(hDriver);
+        return isSuccess;
+    }
+
+    transferObj = &hDriver->syncTransferObj;
+
+    transferObj->slaveAddress   = address;
+    transferObj->writeBuffer    = writeBuffer;
+    transferObj->writeSize      = writeSize;
+    transferObj->readBuffer     = readBuffer;
+    transferObj->readSize       = readSize;
+    transferObj->flag           = transferFlags;
+    transferObj->clientHandle   = (uintptr_t)clientObj;
+
+#if (DRV_I2C_SYNC_TASK_NOTIFY == 1)
+    hDriver->transferTask = xTaskGetCurrentTaskHandle();
+#endif
+
+    /* The transfer is started right away if the bus is free, otherwise
+     * once the queued transfers ahead of it have completed */
+    queuedTick = xTaskGetTickCount();
+
+    _DRV_I2C_TransferQueue(hDriver, transferObj);
+
+    /* Wait till transfer completes. The wake-up is posted from the ISR, or
+     * by the timeout check once the transfer on the bus has timed out. This
+     * transfer may also be behind others that time out first, or be held
+     * back by an owner of the bus, then it leaves the queue at its own
+     * deadline */
+    while (true)
+    {
+#if (DRV_I2C_SYNC_TASK_NOTIFY == 1)
+        woken = (ulTaskNotifyTakeIndexed(DRV_I2C_SYNC_NOTIFY_INDEX, pdTRUE,
+            (waitMS == OSAL_WAIT_FOREVER) ? portMAX_DELAY : pdMS_TO_TICKS(waitMS)) != 0U);
+#else
+        woken = (OSAL_SEM_Pend( &hDriver->transferDone, waitMS ) == OSAL_RESULT_TRUE);
+#endif
+        if (woken == true)
+        {
+            break;
+        }
+
+        _DRV_I2C_TransferTimeoutCheck(hDriver);
+
+        if (_DRV_I2C_SyncTransferExpire(hDriver, transferObj, queuedTick, waitMS) == true)
+        {
+            break;
+        }
+    }
+
+    /* Only an ISR to task wake-up is timed, a timeout check run by this
+     * task notifies itself */
+    if ((woken == true) && (hDriver->transferDoneFromISR == true))
+    {
+        _DRV_I2C_WakeTimeUpdate(hDriver);
+    }
+
+    if (hDriver->transferStatus == DRV_I2C_TRANSFER_STATUS_COMPLETE)
+    {
+        isSuccess = true;
+    }
+
+    /* Allow other threads to access the PLIB */
+#if (DRV_I2C_SYNC_TASK_NOTIFY == 1)
+    _DRV_I2C_SyncTransferRelease(hDriver, mutexLocked);
+#else
+    OSAL_MUTEX_Unlock(&hDriver->transferMutex);
+#endif
+
+    return isSuccess;
+}
+
+bool DRV_I2C_ReadTransfer(
+    const DRV_HANDLE handle,
+    uint16_t address,
+    void* const readBuffer,
+    const size_t readSize
+)
+{
+    return _DRV_I2C_WriteReadTransfer(
+        handle,
+        address,
+        NULL,
+        0,
+        readBuffer,
+        readSize,
+        DRV_I2C_TRANSFER_OBJ_FLAG_READ
+    );
+}
+
+bool DRV_I2C_WriteTransfer(
+    const DRV_HANDLE handle,
+    uint16_t address,
+    void* const writeBuffer,
+    const size_t writeSize
+)
+{
+    return _DRV_I2C_WriteReadTransfer(
+        handle,
+        address,
+        writeBuffer,
+        writeSize,
+        NULL,
+        0,
+        DRV_I2C_TRANSFER_OBJ_FLAG_WRITE
+    );
+}
+
+bool DRV_I2C_WriteReadTransfer (
+    const DRV_HANDLE handle,
+    uint16_t address,
+    void* const writeBuffer,
+    const size_t writeSize,
+    void* const readBuffer,
+    const size_t readSize
+)
+{
+    return _DRV_I2C_WriteReadTransfer(
+        handle,
+        address,
+        writeBuffer,
+        writeSize,
+        readBuffer,
+        readSize,
+        DRV_I2C_TRANSFER_OBJ_FLAG_WRITE_READ
+    );
+}
+
+bool DRV_I2C_WriteVectorTransfer(
+    const DRV_HANDLE handle,
+    uint16_t address,
+    const DRV_I2C_SEGMENT* const segments,
+    const size_t segmentCount
+)
+{
+    return _DRV_I2C_WriteReadTransfer(
+        handle,
+        address,
+        (void*)segments,
+        segmentCount,
+        NULL,
+        0,
+        DRV_I2C_TRANSFER_OBJ_FLAG_WRITE_VECTOR
+    );
+}
+
+bool DRV_I2C_ChainTransfer(
+    const DRV_HANDLE handle,
+    const DRV_I2C_CHAIN_TRANSFER* const chain,
+    const size_t count
+)
+{
+    return _DRV_I2C_WriteReadTransfer(
+        handle,
+        0,
+        (void*)chain,
+        count,
+        NULL,
+        0,
+        DRV_I2C_TRANSFER_OBJ_FLAG_CHAIN
+    );
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Asynchronous (Queuing Model) Transfer Routines
+// *****************************************************************************
+// *****************************************************************************
+
+static void _DRV_I2C_TransferAdd (
+    const DRV_HANDLE handle,
+    const uint16_t address,
+    void* const writeBuffer,
+    const size_t writeSize,
+    void* const readBuffer,
+    const size_t readSize,
+    DRV_I2C_TRANSFER_HANDLE* const transferHandle,
+    DRV_I2C_TRANSFER_OBJ_FLAGS transferFlags
+)
+{
+    DRV_I2C_CLIENT_OBJ* clientObj = (DRV_I2C_CLIENT_OBJ *)NULL;
+    DRV_I2C_OBJ* hDriver = (DRV_I2C_OBJ*)NULL;
+    DRV_I2C_TRANSFER_OBJ* transferObj = (DRV_I2C_TRANSFER_OBJ*)NULL;
+    uint32_t drvInstance;
+    uint32_t iEntry;
+    bool intState;
+
+    if (transferHandle == NULL)
+    {
+        return;
+    }
+
+    *transferHandle = DRV_I2C_TRANSFER_HANDLE_INVALID;
+
+    /* Validate the driver handle */
+    clientObj = _DRV_I2C_DriverHandleValidate(handle);
+
+    if (clientObj == NULL)
+    {
+        return;
+    }
+
+    if ((((transferFlags == DRV_I2C_TRANSFER_OBJ_FLAG_READ) || (transferFlags == DRV_I2C_TRANSFER_OBJ_FLAG_WRITE_READ)) &&
+         ((readSize == 0) || (readBuffer == NULL))) ||
+        ((transferFlags != DRV_I2C_TRANSFER_OBJ_FLAG_READ) && ((writeSize == 0) || (writeBuffer == NULL))))
+    {
+        return;
+    }
+
+    hDriver = clientObj->hDriver;
+    drvInstance = ((handle & DRV_I2C_INSTANCE_INDEX_MASK) >> 8);
+
+    /* Allocate a transfer object. The pool is also accessed from the
+     * transfer event handler, hence the interrupt lock. */
+    intState = SYS_INT_Disable();
+
+    for (iEntry = 0; iEntry < hDriver->transferObjPoolSize; iEntry++)
+    {
+        if (hDriver->transferObjPool[iEntry].inUse == false)
+        {
+            transferObj = &hDriver->transferObjPool[iEntry];
+            transferObj->inUse = true;
+            transferObj->transferHandle = _DRV_I2C_MAKE_HANDLE(hDriver->transferTokenCount, drvInstance, iEntry);
+            hDriver->transferTokenCount = _DRV_I2C_UPDATE_TOKEN(hDriver->transferTokenCount);
+            break;
+        }
+    }
+
+    SYS_INT_Restore(intState);
+
+    if (transferObj == NULL)
+    {
+        /* The transfer queue is full */
+        return;
+    }
+
+    transferObj->slaveAddress   = address;
+    transferObj->writeBuffer    = writeBuffer;
+    transferObj->writeSize      = writeSize;
+    transferObj->readBuffer     = readBuffer;
+    transferObj->readSize       = readSize;
+    transferObj->flag           = transferFlags;
+    transferObj->clientHandle   = (uintptr_t)clientObj;
+
+    /* The handle must be valid before the transfer can possibly complete */
+    *transferHandle = transferObj->transferHandle;
+
+    _DRV_I2C_TransferQueue(hDriver, transferObj);
+}
+
+void DRV_I2C_ReadTransferAdd(
+    const DRV_HANDLE handle,
+    const uint16_t address,
+    void * const buffer,
+    const size_t size,
+    DRV_I2C_TRANSFER_HANDLE * const transferHandle
+)
+{
+    _DRV_I2C_TransferAdd(handle, address, NULL, 0, buffer, size, transferHandle, DRV_I2C_TRANSFER_OBJ_FLAG_READ);
+}
+
+void DRV_I2C_WriteTransferAdd(
+    const DRV_HANDLE handle,
+    const uint16_t address,
+    void * const buffer,
+    const size_t size,
+    DRV_I2C_TRANSFER_HANDLE * const transferHandle
+)
+{
+    _DRV_I2C_TransferAdd(handle, address, buffer, size, NULL, 0, transferHandle, DRV_I2C_TRANSFER_OBJ_FLAG_WRITE);
+}
+
+void DRV_I2C_WriteReadTransferAdd (
+    const DRV_HANDLE handle,
+    const uint16_t address,
+    void * const writeBuffer,
     const size_t writeSize,
-    void* const readBuffer,
+    void * const readBuffer,
     const size_t readSize,
-    DRV_I2C_TRANSFER_OBJ_FLAGS transferFlags
+    DRV_I2C_TRANSFER_HANDLE * const transferHandle
 )
 {
-    DRV_I2C_CLIENT_OBJ* clientObj = (DRV_I2C_CLIENT_OBJ *)NULL;
-    DRV_I2C_OBJ* hDriver = (DRV_I2C_OBJ*)NULL;
-    bool isSuccess = false;
-    bool isReqAccepted = false;
+    _DRV_I2C_TransferAdd(handle, address, writeBuffer, writeSize, readBuffer, readSize, transferHandle, DRV_I2C_TRANSFER_OBJ_FLAG_WRITE_READ);
+}
+
+void DRV_I2C_WriteVectorTransferAdd(
+    const DRV_HANDLE handle,
+    const uint16_t address,
+    const DRV_I2C_SEGMENT * const segments,
+    const size_t segmentCount,
+    DRV_I2C_TRANSFER_HANDLE * const transferHandle
+)
+{
+    _DRV_I2C_TransferAdd(handle, address, (void*)segments, segmentCount, NULL, 0, transferHandle, DRV_I2C_TRANSFER_OBJ_FLAG_WRITE_VECTOR);
+}
+
+void DRV_I2C_ChainTransferAdd(
+    const DRV_HANDLE handle,
+    const DRV_I2C_CHAIN_TRANSFER * const chain,
+    const size_t count,
+    DRV_I2C_TRANSFER_HANDLE * const transferHandle
+)
+{
+    _DRV_I2C_TransferAdd(handle, 0, (void*)chain, count, NULL, 0, transferHandle, DRV_I2C_TRANSFER_OBJ_FLAG_CHAIN);
+}
+
+void DRV_I2C_TransferEventHandlerSet(
+    const DRV_HANDLE handle,
+    const DRV_I2C_TRANSFER_EVENT_HANDLER eventHandler,
+    const uintptr_t context
+)
+{
+    DRV_I2C_CLIENT_OBJ* clientObj = NULL;
 
     /* Validate the driver handle */
     clientObj = _DRV_I2C_DriverHandleValidate(handle);
 
-    if (clientObj == NULL)
+    if (clientObj != NULL)
     {
-        return isSuccess;
+        /* Context is stored first so that it is valid by the time the
+         * handler can be called */
+        clientObj->context = context;
+        clientObj->eventHandler = eventHandler;
     }
+}
 
-    if (transferFlags == DRV_I2C_TRANSFER_OBJ_FLAG_READ)
+bool DRV_I2C_TransferPrioritySet( const DRV_HANDLE handle, const DRV_I2C_TRANSFER_PRIORITY priority )
+{
+    DRV_I2C_CLIENT_OBJ* clientObj = NULL;
+
+    if (priority >= DRV_I2C_TRANSFER_PRIORITY_NUMBER)
     {
-        if((readSize == 0) || (readBuffer == NULL))
-        {
-            return isSuccess;
-        }
+        return false;
     }
-    else if ((transferFlags == DRV_I2C_TRANSFER_OBJ_FLAG_WRITE) || (transferFlags == DRV_I2C_TRANSFER_OBJ_FLAG_WRITE_FORCED))
+
+    /* Validate the driver handle */
+    clientObj = _DRV_I2C_DriverHandleValidate(handle);
+
+    if (clientObj == NULL)
     {
-        if((writeSize == 0) || (writeBuffer == NULL))
-        {
-            return isSuccess;
-        }
+        return false;
     }
-    else
+
+    clientObj->priority = priority;
+
+    return true;
+}
+
+bool DRV_I2C_TransferTimeoutSet( const DRV_HANDLE handle, const uint16_t timeoutMs )
+{
+    DRV_I2C_CLIENT_OBJ* clientObj = NULL;
+
+    /* Validate the handle */
+    clientObj = _DRV_I2C_DriverHandleValidate(handle);
+
+    if (clientObj == NULL)
     {
-        if((writeSize == 0) || (writeBuffer == NULL) || (readSize == 0) || (readBuffer == NULL))
-        {
-            return isSuccess;
-        }
+        return false;
     }
 
-    hDriver = clientObj->hDriver;
+    clientObj->transferTimeout = timeoutMs;
 
+    return true;
+}
 
-    /* Block other threads from accessing the PLIB */
-    if (OSAL_MUTEX_Lock(&hDriver->transferMutex, OSAL_WAIT_FOREVER ) == OSAL_RESULT_TRUE)
-    {
-        /* Error is cleared for every new transfer */
-        clientObj->errors = DRV_I2C_ERROR_NONE;
+bool DRV_I2C_BusAcquire( const DRV_HANDLE handle, const uint16_t waitMs )
+{
+    DRV_I2C_CLIENT_OBJ* clientObj = NULL;
+    DRV_I2C_OBJ* dObj;
+    TickType_t startTick = xTaskGetTickCount();
+    bool acquired = false;
+    bool intState;
 
-        /* Errors if any, will be saved in the activeClient in the driver callback */
-        hDriver->activeClient = (uintptr_t)clientObj;
+    /* Validate the handle */
+    clientObj = _DRV_I2C_DriverHandleValidate(handle);
 
-        /* Check if the transfer setup for this client is different than the current transfer setup */
-        if (hDriver->currentTransferSetup.clockSpeed != clientObj->transferSetup.clockSpeed)
-        {
-            /* Set the new transfer setup */
-            hDriver->i2cPlib->transferSetup(&clientObj->transferSetup, 0);
+    if (clientObj == NULL)
+    {
+        return false;
+    }
 
-            hDriver->currentTransferSetup.clockSpeed = clientObj->transferSetup.clockSpeed;
-        }
+    dObj = clientObj->hDriver;
 
-        switch(transferFlags)
-        {
-            case DRV_I2C_TRANSFER_OBJ_FLAG_READ:
-                if (hDriver->i2cPlib->read(address, readBuffer, readSize) == true)
-                {
-                    isReqAccepted = true;
-                }
-                break;
+    /* Hold the queue from now on, so the bus drains instead of staying busy */
+    intState = SYS_INT_Disable();
 
-            case DRV_I2C_TRANSFER_OBJ_FLAG_WRITE:
-                if (hDriver->i2cPlib->write(address, writeBuffer, writeSize) == true)
-                {
-                    isReqAccepted = true;
-                }
-                break;
+    if (dObj->busOwner == 0U)
+    {
+        dObj->busOwner = (uintptr_t)clientObj;
+    }
 
+    SYS_INT_Restore(intState);
 
-            case DRV_I2C_TRANSFER_OBJ_FLAG_WRITE_READ:
-                if (hDriver->i2cPlib->writeRead(address, writeBuffer, writeSize, readBuffer, readSize) == true)
-                {
-                    isReqAccepted = true;
-                }
-                break;
+    if (dObj->busOwner != (uintptr_t)clientObj)
+    {
+        return false;
+    }
 
-            default:
-                break;
-        }
+    /* The transfer on the bus, if any, completes or times out as usual */
+    while (true)
+    {
+        intState = SYS_INT_Disable();
 
-        if (isReqAccepted == true)
+        if ((dObj->activeTransfer == NULL) && (dObj->busRecovering == false))
         {
-            /* Wait till transfer completes. This semaphore is released from ISR */
-            if (OSAL_SEM_Pend( &hDriver->transferDone, OSAL_WAIT_FOREVER ) == OSAL_RESULT_TRUE)
-            {
-                if (hDriver->transferStatus == DRV_I2C_TRANSFER_STATUS_COMPLETE)
-                {
-                    isSuccess = true;
-                }
-            }
+            dObj->busOwned = true;
+            acquired = true;
         }
-        else
-        {
-            /* Update error into the client object*/
-            clientObj->errors = hDriver->i2cPlib->errorGet();
 
-            if(clientObj->errors == DRV_I2C_ERROR_NONE)
-            {
-                hDriver->transferStatus = DRV_I2C_TRANSFER_STATUS_COMPLETE;
-            }
-            else
-            {
-                hDriver->transferStatus = DRV_I2C_TRANSFER_STATUS_ERROR;
-            }
+        SYS_INT_Restore(intState);
+
+        if ((acquired == true) || ((xTaskGetTickCount() - startTick) >= pdMS_TO_TICKS(waitMs)))
+        {
+            break;
         }
 
-        /* Release the mutex to allow other threads to access the PLIB */
-        OSAL_MUTEX_Unlock(&hDriver->transferMutex);
+        vTaskDelay(1);
     }
 
-    return isSuccess;
+    if (acquired == false)
+    {
+        /* Let the held transfers go */
+        dObj->busOwner = 0U;
+
+        _DRV_I2C_TransferProcessNext(dObj);
+    }
+
+    return acquired;
 }
 
-bool DRV_I2C_ReadTransfer(
-    const DRV_HANDLE handle,
-    uint16_t address,
-    void* const readBuffer,
-    const size_t readSize
-)
+void DRV_I2C_BusRelease( const DRV_HANDLE handle )
 {
-    return _DRV_I2C_WriteReadTransfer(
-        handle,
-        address,
-        NULL,
-        0,
-        readBuffer,
-        readSize,
-        DRV_I2C_TRANSFER_OBJ_FLAG_READ
-    );
+    DRV_I2C_CLIENT_OBJ* clientObj = NULL;
+    DRV_I2C_OBJ* dObj;
+
+    /* Validate the handle */
+    clientObj = _DRV_I2C_DriverHandleValidate(handle);
+
+    if (clientObj == NULL)
+    {
+        return;
+    }
+
+    dObj = clientObj->hDriver;
+
+    if ((dObj->busOwner != (uintptr_t)clientObj) || (dObj->busOwned == false))
+    {
+        return;
+    }
+
+    /* The owner may have left the baud rate changed, the next transfer
+     * reprograms it */
+    dObj->currentTransferSetup.clockSpeed = 0;
+
+    dObj->busOwned = false;
+    dObj->busOwner = 0U;
+
+    _DRV_I2C_TransferProcessNext(dObj);
 }
 
-bool DRV_I2C_WriteTransfer(
-    const DRV_HANDLE handle,
-    uint16_t address,
-    void* const writeBuffer,
-    const size_t writeSize
-)
+bool DRV_I2C_QueueStatisticsGet( const DRV_HANDLE handle, DRV_I2C_QUEUE_STATISTICS* const stats )
 {
-    return _DRV_I2C_WriteReadTransfer(
-        handle,
-        address,
-        writeBuffer,
-        writeSize,
-        NULL,
-        0,
-        DRV_I2C_TRANSFER_OBJ_FLAG_WRITE
-    );
+    DRV_I2C_CLIENT_OBJ* clientObj = NULL;
+    bool intState;
+
+    if (stats == NULL)
+    {
+        return false;
+    }
+
+    /* Validate the driver handle */
+    clientObj = _DRV_I2C_DriverHandleValidate(handle);
+
+    if (clientObj == NULL)
+    {
+        return false;
+    }
+
+    /* Updated from the transfer event path */
+    intState = SYS_INT_Disable();
+
+    *stats = clientObj->hDriver->queueStats;
+
+    SYS_INT_Restore(intState);
+
+    return true;
 }
 
-bool DRV_I2C_WriteReadTransfer (
+void DRV_I2C_QueueStatisticsReset( const DRV_HANDLE handle )
+{
+    DRV_I2C_CLIENT_OBJ* clientObj = NULL;
+    DRV_I2C_OBJ* dObj;
+    uint32_t queueDepth;
+    bool intState;
+
+    /* Validate the driver handle */
+    clientObj = _DRV_I2C_DriverHandleValidate(handle);
+
+    if (clientObj != NULL)
+    {
+        dObj = clientObj->hDriver;
+
+        intState = SYS_INT_Disable();
+
+        queueDepth = dObj->queueStats.queueDepth;
+        memset(&dObj->queueStats, 0, sizeof(dObj->queueStats));
+        dObj->queueStats.queueDepth = queueDepth;
+        dObj->queueStats.queueDepthMax = queueDepth;
+
+        SYS_INT_Restore(intState);
+    }
+}
+
+bool DRV_I2C_TransferStatisticsGet(
     const DRV_HANDLE handle,
-    uint16_t address,
-    void* const writeBuffer,
-    const size_t writeSize,
-    void* const readBuffer,
-    const size_t readSize
+    DRV_I2C_TRANSFER_STATISTICS* const clientStats,
+    DRV_I2C_TRANSFER_STATISTICS* const instanceStats
 )
 {
-    return _DRV_I2C_WriteReadTransfer(
-        handle,
-        address,
-        writeBuffer,
-        writeSize,
-        readBuffer,
-        readSize,
-        DRV_I2C_TRANSFER_OBJ_FLAG_WRITE_READ
-    );
+    DRV_I2C_CLIENT_OBJ* clientObj = NULL;
+    bool intState;
+
+    /* Validate the driver handle */
+    clientObj = _DRV_I2C_DriverHandleValidate(handle);
+
+    if (clientObj == NULL)
+    {
+        return false;
+    }
+
+    /* The statistics are updated from the PLIB interrupt */
+    intState = SYS_INT_Disable();
+
+    if (clientStats != NULL)
+    {
+        *clientStats = clientObj->transferStats;
+    }
+
+    if (instanceStats != NULL)
+    {
+        *instanceStats = clientObj->hDriver->transferStats;
+    }
+
+    SYS_INT_Restore(intState);
+
+    return true;
+}
+
+void DRV_I2C_TransferStatisticsReset( const DRV_HANDLE handle )
+{
+    DRV_I2C_CLIENT_OBJ* clientObj = NULL;
+    bool intState;
+
+    /* Validate the driver handle */
+    clientObj = _DRV_I2C_DriverHandleValidate(handle);
+
+    if (clientObj != NULL)
+    {
+        intState = SYS_INT_Disable();
+
+        memset(&clientObj->transferStats, 0, sizeof(clientObj->transferStats));
+        memset(&clientObj->hDriver->transferStats, 0, sizeof(clientObj->hDriver->transferStats));
+
+        SYS_INT_Restore(intState);
+    }
+}
+
+DRV_I2C_TRANSFER_EVENT DRV_I2C_TransferStatusGet( const DRV_I2C_TRANSFER_HANDLE transferHandle )
+{
+    uint32_t drvInstance;
+    uint32_t iEntry;
+    DRV_I2C_TRANSFER_OBJ* transferObj;
+
+    if ((transferHandle == DRV_I2C_TRANSFER_HANDLE_INVALID) || (transferHandle == 0))
+    {
+        return DRV_I2C_TRANSFER_EVENT_HANDLE_INVALID;
+    }
+
+    drvInstance = ((transferHandle & DRV_I2C_INSTANCE_INDEX_MASK) >> 8);
+    iEntry = (transferHandle & DRV_I2C_CLIENT_INDEX_MASK);
+
+    if ((drvInstance >= DRV_I2C_INSTANCES_NUMBER) || (iEntry >= gDrvI2CObj[drvInstance].transferObjPoolSize))
+    {
+        return DRV_I2C_TRANSFER_EVENT_HANDLE_INVALID;
+    }
+
+    transferObj = &gDrvI2CObj[drvInstance].transferObjPool[iEntry];
+
+    if ((transferObj->inUse == false) || (transferObj->transferHandle != transferHandle))
+    {
+        return DRV_I2C_TRANSFER_EVENT_HANDLE_EXPIRED;
+    }
+
+    return transferObj->event;
 }
 /*******************************************************************************
  End of File
@@ -51,6 +51,18 @@
 
 #include "osal/osal.h"
 
+/* Notification index used to wake a task blocked in a transfer, leaving
+ * index 0 to the application */
+#ifndef DRV_I2C_SYNC_NOTIFY_INDEX
+#define DRV_I2C_SYNC_NOTIFY_INDEX               1
+#endif
+
+/* Notification index used to wake the task running DRV_I2C_Tasks when a
+ * transfer goes on the bus */
+#ifndef DRV_I2C_TASKS_NOTIFY_INDEX
+#define DRV_I2C_TASKS_NOTIFY_INDEX              0
+#endif
+
 
 // *****************************************************************************
 // *****************************************************************************
@@ -106,6 +118,14 @@ typedef enum
     /* Indicates this buffer was submitted by a force write function */
     DRV_I2C_TRANSFER_OBJ_FLAG_WRITE_FORCED = 1 << 3,
 
+    /* Indicates this buffer was submitted by a vectored write function. The
+     * write buffer holds the segment array and the write size its length */
+    DRV_I2C_TRANSFER_OBJ_FLAG_WRITE_VECTOR = 1 << 4,
+
+    /* Indicates this buffer was submitted by a chain function. The write
+     * buffer holds the chain and the write size its length */
+    DRV_I2C_TRANSFER_OBJ_FLAG_CHAIN = 1 << 5,
+
 } DRV_I2C_TRANSFER_OBJ_FLAGS;
 
 // *****************************************************************************
@@ -131,6 +151,72 @@ typedef enum
 
 } DRV_I2C_TRANSFER_STATUS;
 
+// *****************************************************************************
+/* I2C Driver Transfer Object
+
+  Summary:
+    Object used to keep track of a client's transfer request.
+
+  Description:
+    Transfer objects are allocated from the pool passed in DRV_I2C_INIT for
+    requests queued through the DRV_I2C_xxxTransferAdd routines. The blocking
+    transfer routines use a transfer object embedded in the driver instance.
+    Both kinds of request share the instance transfer queue, which serializes
+    them on the bus.
+
+  Remarks:
+    None.
+*/
+
+typedef struct _DRV_I2C_TRANSFER_OBJ
+{
+    /* Slave address */
+    uint16_t                            slaveAddress;
+
+    /* Pointer to the source buffer */
+    void*                               writeBuffer;
+
+    /* Number of bytes to be written */
+    size_t                              writeSize;
+
+    /* Pointer to the destination buffer */
+    void*                               readBuffer;
+
+    /* Number of bytes to be read */
+    size_t                              readSize;
+
+    /* Transfer type */
+    DRV_I2C_TRANSFER_OBJ_FLAGS          flag;
+
+    /* Current status of the transfer */
+    volatile DRV_I2C_TRANSFER_EVENT     event;
+
+    /* Handle returned to the client for this transfer */
+    DRV_I2C_TRANSFER_HANDLE             transferHandle;
+
+    /* The client that submitted the transfer */
+    uintptr_t                           clientHandle;
+
+    /* Queue priority, from the client at submission */
+    DRV_I2C_TRANSFER_PRIORITY           priority;
+
+    /* DWT cycle count at submission */
+    uint32_t                            queuedCycles;
+
+    /* Chain transaction on the bus, for DRV_I2C_TRANSFER_OBJ_FLAG_CHAIN */
+    size_t                              chainIndex;
+
+    /* DWT cycle count when handed to the PLIB */
+    uint32_t                            startCycles;
+
+    /* This flag indicates if the object is in use or is available */
+    bool                                inUse;
+
+    /* Next transfer in the queue */
+    struct _DRV_I2C_TRANSFER_OBJ*       next;
+
+} DRV_I2C_TRANSFER_OBJ;
+
 // *****************************************************************************
 /* I2C Driver Instance Object
 
@@ -167,6 +253,9 @@ typedef struct
     /* Saves the initial value of the I2C clock speed which is assigned to a client when it opens the I2C driver */
     uint32_t                        initI2CClockSpeed;
 
+    /* Transfer timeout assigned to a client when it opens the I2C driver */
+    uint16_t                        initTransferTimeout;
+
     /* Current transfer setup will be used to verify change in the transfer setup by client */
     DRV_I2C_TRANSFER_SETUP          currentTransferSetup;
 
@@ -181,6 +270,53 @@ typedef struct
     /* The client of the active transfer on this driver instance */
     uintptr_t                       activeClient;
 
+    /* Memory pool for Transfer Objects */
+    DRV_I2C_TRANSFER_OBJ*           transferObjPool;
+
+    /* Number of objects in the transfer object pool */
+    size_t                          transferObjPoolSize;
+
+    /* Instance specific token counter used to generate transfer handles */
+    uint16_t                        transferTokenCount;
+
+    /* Queue of pending transfers, in priority order. The head is the next
+     * transfer to be started, or the transfer on the bus if activeTransfer
+     * is not NULL */
+    DRV_I2C_TRANSFER_OBJ* volatile  transferQueueHead;
+
+    DRV_I2C_TRANSFER_OBJ* volatile  transferQueueTail;
+
+    /* Transfer currently being processed by the PLIB */
+    DRV_I2C_TRANSFER_OBJ* volatile  activeTransfer;
+
+    /* RTOS tick count when the active transfer was handed to the PLIB */
+    volatile TickType_t             activeStartTick;
+
+    /* A timed out transfer is being aborted and the bus cleared. PLIB
+     * callbacks are ignored until it has been retired */
+    volatile bool                   busRecovering;
+
+    /* Task running DRV_I2C_Tasks, notified when a transfer is started so
+     * it can block while the bus is idle */
+    TaskHandle_t volatile           tasksTask;
+
+    /* Client taking the peripheral over with DRV_I2C_BusAcquire. Queued
+     * transfers are held from the moment it asks, busOwned is set once the
+     * transfer that was on the bus has ended and the client may use the
+     * peripheral directly; the timeout check then leaves the instance alone */
+    uintptr_t volatile              busOwner;
+
+    volatile bool                   busOwned;
+
+    /* Transfer object used by the blocking transfer routines */
+    DRV_I2C_TRANSFER_OBJ            syncTransferObj;
+
+    /* Queue depth and wait time statistics */
+    DRV_I2C_QUEUE_STATISTICS        queueStats;
+
+    /* Counters and latency histograms of all the transfers */
+    DRV_I2C_TRANSFER_STATISTICS     transferStats;
+
     /* Status of the active transfer */
     volatile DRV_I2C_TRANSFER_STATUS transferStatus;
 
@@ -190,8 +326,24 @@ typedef struct
     /* Mutex to protect access to the client object pool */
     OSAL_MUTEX_DECLARE(clientMutex);
 
+#if (DRV_I2C_SYNC_TASK_NOTIFY == 1)
+    /* Task blocked in the active blocking transfer, notified from ISR */
+    TaskHandle_t volatile           transferTask;
+
+    /* The blocking transfer object is in use. Taken without the mutex
+     * while a single client is open */
+    volatile bool                   syncTransferBusy;
+#else
     /* Semaphore to wait for transfer to complete. This is released from ISR*/
     OSAL_SEM_DECLARE(transferDone);
+#endif
+
+    /* DWT cycle count when the blocking transfer completed */
+    volatile uint32_t               transferDoneCycles;
+
+    /* The blocking transfer was completed by the PLIB interrupt, not by a
+     * timeout check in task context */
+    volatile bool                   transferDoneFromISR;
 
 } DRV_I2C_OBJ;
 
@@ -230,6 +382,22 @@ typedef struct
     /* Client specific transfer setup */
     DRV_I2C_TRANSFER_SETUP          transferSetup;
 
+    /* Application event handler for queued transfers */
+    DRV_I2C_TRANSFER_EVENT_HANDLER  eventHandler;
+
+    /* Application context passed back with the event */
+    uintptr_t                       context;
+
+    /* Queue priority of the transfers submitted by this client */
+    DRV_I2C_TRANSFER_PRIORITY       priority;
+
+    /* Time a transfer of this client may spend on the bus, in milliseconds.
+     * 0 waits forever */
+    uint16_t                        transferTimeout;
+
+    /* Counters and latency histograms of the client's transfers */
+    DRV_I2C_TRANSFER_STATISTICS     transferStats;
+
 } DRV_I2C_CLIENT_OBJ;
 
 #endif //#ifndef _DRV_I2C_LOCAL_H
@@ -83,9 +83,30 @@
 /* I2C Client Objects Pool */
 static DRV_I2C_CLIENT_OBJ drvI2C0ClientObjPool[DRV_I2C_CLIENTS_NUMBER_IDX0];
 
+/* I2C Transfer Objects Pool */
+static DRV_I2C_TRANSFER_OBJ drvI2C0TransferObj[DRV_I2C_QUEUE_SIZE_IDX0];
+
 /* I2C PLib Interface Initialization */
 const DRV_I2C_PLIB_INTERFACE drvI2C0PLibAPI = {
 
+#if DRV_I2C_PLIB_DMA_IDX0 == 1
+    /* I2C PLib Transfer Read Add function */
+    .read = (DRV_I2C_PLIB_READ)SERCOM3_I2C_DMA_Read,
+
+    /* I2C PLib Transfer Write Add function */
+    .write = (DRV_I2C_PLIB_WRITE)SERCOM3_I2C_DMA_Write,
+
+
+    /* I2C PLib Transfer Write Read Add function */
+#if DRV_I2C_PLIB_SMART_IDX0 == 1
+    .writeRead = (DRV_I2C_PLIB_WRITE_READ)SERCOM3_I2C_SMART_WriteRead,
+#else
+    .writeRead = (DRV_I2C_PLIB_WRITE_READ)SERCOM3_I2C_DMA_WriteRead,
+#endif
+
+    /* I2C PLib Transfer Write Vector Add function */
+    .writeVector = (DRV_I2C_PLIB_WRITE_VECTOR)SERCOM3_I2C_DMA_WriteVector,
+#else
     /* I2C PLib Transfer Read Add function */
     .read = (DRV_I2C_PLIB_READ)SERCOM3_I2C_Read,
 
@@ -96,9 +117,16 @@ const DRV_I2C_PLIB_INTERFACE drvI2C0PLibAPI = {
     /* I2C PLib Transfer Write Read Add function */
     .writeRead = (DRV_I2C_PLIB_WRITE_READ)SERCOM3_I2C_WriteRead,
 
+    /* I2C PLib Transfer Write Vector Add function */
+    .writeVector = (DRV_I2C_PLIB_WRITE_VECTOR)SERCOM3_I2C_WriteVector,
+#endif
+
     /*I2C PLib Transfer Abort function */
     .transferAbort = (DRV_I2C_PLIB_TRANSFER_ABORT)SERCOM3_I2C_TransferAbort,
 
+    /* I2C PLib Bus Recover function */
+    .busRecover = (DRV_I2C_PLIB_BUS_RECOVER)SERCOM3_I2C_BusRecover,
+
     /* I2C PLib Transfer Status function */
     .errorGet = (DRV_I2C_PLIB_ERROR_GET)SERCOM3_I2C_ErrorGet,
 
@@ -122,8 +150,17 @@ const DRV_I2C_INIT drvI2C0InitData =
     /* I2C Client Objects Pool */
     .clientObjPool = (uintptr_t)&drvI2C0ClientObjPool[0],
 
+    /* I2C Transfer Objects Pool */
+    .transferObj = (uintptr_t)&drvI2C0TransferObj[0],
+
+    /* I2C Transfer Queue Size */
+    .queueSize = DRV_I2C_QUEUE_SIZE_IDX0,
+
     /* I2C Clock Speed */
     .clockSpeed = DRV_I2C_CLOCK_SPEED_IDX0,
+
+    /* I2C Transfer Timeout */
+    .transferTimeout = DRV_I2C_TRANSFER_TIMEOUT_MS_IDX0,
 };
 
 // </editor-fold>
@@ -208,6 +245,7 @@ void SYS_Initialize ( void* data )
 
 
 
+    DMAC_Initialize();
 
     SERCOM3_I2C_Initialize();
 
@@ -217,6 +255,8 @@ void SYS_Initialize ( void* data )
 
     EIC_Initialize();
 
+    RTC_Initialize();
+
     /* Initialize I2C0 Driver Instance */
     sysObj.drvI2C0 = DRV_I2C_Initialize(DRV_I2C_INDEX_0, (SYS_MODULE_INIT *)&drvI2C0InitData);
     
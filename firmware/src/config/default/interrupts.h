@@ -65,7 +65,12 @@ void BusFault_Handler (void);
 void UsageFault_Handler (void);
 void DebugMonitor_Handler (void);
 void xPortSysTickHandler (void);
+void RTC_InterruptHandler (void);
+void DMAC_0_InterruptHandler (void);
+void DMAC_1_InterruptHandler (void);
+void DMAC_2_InterruptHandler (void);
 void EIC_EXTINT_7_InterruptHandler (void);
+void SERCOM2_USART_InterruptHandler (void);
 void SERCOM3_I2C_InterruptHandler (void);
 
 
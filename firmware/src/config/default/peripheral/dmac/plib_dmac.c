@@ -0,0 +1,375 @@
+/*******************************************************************************
+  Direct Memory Access Controller (DMAC) PLIB
+
+  Company
+    Microchip Technology Inc.
+
+  File Name
+    plib_dmac.c
+
+  Summary
+    Source for DMAC peripheral library interface Implementation.
+
+  Description
+    This file defines the interface to the DMAC peripheral library. This
+    library provides access to and control of the DMAC controller.
+
+  Remarks:
+    None.
+
+*******************************************************************************/
+
+// DOM-IGNORE-BEGIN
+/*******************************************************************************
+* Copyright (C) 2018 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+// DOM-IGNORE-END
+
+#include "plib_dmac.h"
+#include "interrupts.h"
+#include <string.h>
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Global Data
+// *****************************************************************************
+// *****************************************************************************
+
+static DMAC_CH_OBJECT dmacChannelObj[DMAC_CHANNELS_NUMBER];
+
+/* Initial write back memory section for DMAC */
+static dmac_descriptor_registers_t write_back_section[DMAC_CHANNELS_NUMBER]  __ALIGNED(16) SECTION_DMAC_DESCRIPTOR;
+
+/* Descriptor section for DMAC */
+static dmac_descriptor_registers_t descriptor_section[DMAC_CHANNELS_NUMBER]  __ALIGNED(16) SECTION_DMAC_DESCRIPTOR;
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: DMAC PLib Interface Implementations
+// *****************************************************************************
+// *****************************************************************************
+
+void DMAC_Initialize( void )
+{
+    uint8_t channel;
+
+    /* Disable the DMAC module and reset it */
+    DMAC_REGS->DMAC_CTRL &= (uint16_t)(~DMAC_CTRL_DMAENABLE_Msk);
+    DMAC_REGS->DMAC_CTRL = DMAC_CTRL_SWRST_Msk;
+
+    /* Wait for the reset to complete */
+    while((DMAC_REGS->DMAC_CTRL & DMAC_CTRL_SWRST_Msk) != 0U)
+    {
+        /* Do nothing */
+    }
+
+    /* Initialize DMAC Channel objects */
+    for(channel = 0U; channel < DMAC_CHANNELS_NUMBER; channel++)
+    {
+        dmacChannelObj[channel].busyStatus = false;
+        dmacChannelObj[channel].callback = NULL;
+        dmacChannelObj[channel].context = 0U;
+    }
+
+    /* Update the Base address and Write Back address register */
+    DMAC_REGS->DMAC_BASEADDR = (uint32_t)descriptor_section;
+    DMAC_REGS->DMAC_WRBADDR  = (uint32_t)write_back_section;
+
+    /* Update the Priority Control register */
+    DMAC_REGS->DMAC_PRICTRL0 = DMAC_PRICTRL0_LVLPRI0(1UL) | DMAC_PRICTRL0_RRLVLEN0_Msk;
+
+    /***************** Configure DMA channel 0 ********************/
+
+    /* SERCOM3 TX: one byte per MB trigger, memory to DATA */
+    DMAC_REGS->CHANNEL[0].DMAC_CHCTRLA = DMAC_CHCTRLA_TRIGACT_BURST | DMAC_CHCTRLA_TRIGSRC(SERCOM3_DMAC_ID_TX) | DMAC_CHCTRLA_THRESHOLD(0UL) | DMAC_CHCTRLA_BURSTLEN_SINGLE;
+
+    DMAC_REGS->CHANNEL[0].DMAC_CHPRILVL = DMAC_CHPRILVL_PRILVL(0U);
+
+    descriptor_section[0].DMAC_BTCTRL = (uint16_t)(DMAC_BTCTRL_BLOCKACT_INT | DMAC_BTCTRL_BEATSIZE_BYTE | DMAC_BTCTRL_VALID_Msk | DMAC_BTCTRL_SRCINC_Msk);
+
+    DMAC_REGS->CHANNEL[0].DMAC_CHINTENSET = (uint8_t)(DMAC_CHINTENSET_TERR_Msk | DMAC_CHINTENSET_TCMPL_Msk);
+
+    /***************** Configure DMA channel 1 ********************/
+
+    /* SERCOM3 RX: one byte per SB trigger, DATA to memory */
+    DMAC_REGS->CHANNEL[1].DMAC_CHCTRLA = DMAC_CHCTRLA_TRIGACT_BURST | DMAC_CHCTRLA_TRIGSRC(SERCOM3_DMAC_ID_RX) | DMAC_CHCTRLA_THRESHOLD(0UL) | DMAC_CHCTRLA_BURSTLEN_SINGLE;
+
+    DMAC_REGS->CHANNEL[1].DMAC_CHPRILVL = DMAC_CHPRILVL_PRILVL(0U);
+
+    descriptor_section[1].DMAC_BTCTRL = (uint16_t)(DMAC_BTCTRL_BLOCKACT_INT | DMAC_BTCTRL_BEATSIZE_BYTE | DMAC_BTCTRL_VALID_Msk | DMAC_BTCTRL_DSTINC_Msk);
+
+    DMAC_REGS->CHANNEL[1].DMAC_CHINTENSET = (uint8_t)(DMAC_CHINTENSET_TERR_Msk | DMAC_CHINTENSET_TCMPL_Msk);
+
+    /***************** Configure DMA channel 2 ********************/
+
+    /* SERCOM3 RX for the acquisition chain, descriptors come from the client */
+    DMAC_REGS->CHANNEL[2].DMAC_CHCTRLA = DMAC_CHCTRLA_TRIGACT_BURST | DMAC_CHCTRLA_TRIGSRC(SERCOM3_DMAC_ID_RX) | DMAC_CHCTRLA_THRESHOLD(0UL) | DMAC_CHCTRLA_BURSTLEN_SINGLE;
+
+    DMAC_REGS->CHANNEL[2].DMAC_CHPRILVL = DMAC_CHPRILVL_PRILVL(0U);
+
+    DMAC_REGS->CHANNEL[2].DMAC_CHINTENSET = (uint8_t)(DMAC_CHINTENSET_TERR_Msk | DMAC_CHINTENSET_TCMPL_Msk);
+
+    /***************** Configure DMA channel 3 ********************/
+
+    /* SERCOM3 TX for the acquisition chain, one beat per MB trigger */
+    DMAC_REGS->CHANNEL[3].DMAC_CHCTRLA = DMAC_CHCTRLA_TRIGACT_BURST | DMAC_CHCTRLA_TRIGSRC(SERCOM3_DMAC_ID_TX) | DMAC_CHCTRLA_THRESHOLD(0UL) | DMAC_CHCTRLA_BURSTLEN_SINGLE;
+
+    DMAC_REGS->CHANNEL[3].DMAC_CHPRILVL = DMAC_CHPRILVL_PRILVL(0U);
+
+    /***************** Configure DMA channel 4 ********************/
+
+    /* No peripheral trigger, each EVSYS channel 0 event runs one block */
+    DMAC_REGS->CHANNEL[4].DMAC_CHCTRLA = DMAC_CHCTRLA_TRIGACT_BLOCK | DMAC_CHCTRLA_TRIGSRC(0UL) | DMAC_CHCTRLA_THRESHOLD(0UL) | DMAC_CHCTRLA_BURSTLEN_SINGLE;
+
+    DMAC_REGS->CHANNEL[4].DMAC_CHPRILVL = DMAC_CHPRILVL_PRILVL(0U);
+
+    DMAC_REGS->CHANNEL[4].DMAC_CHEVCTRL = (uint8_t)(DMAC_CHEVCTRL_EVIE_Msk | DMAC_CHEVCTRL_EVACT_TRIG);
+
+    /* Enable the DMAC module & Priority Level x Enable */
+    DMAC_REGS->DMAC_CTRL = (uint16_t)(DMAC_CTRL_DMAENABLE_Msk | DMAC_CTRL_LVLEN0_Msk);
+}
+
+/*******************************************************************************
+    This function schedules a DMA transfer on the specified DMA channel.
+    Incrementing addresses are programmed as end addresses, as the DMAC
+    expects.
+********************************************************************************/
+
+bool DMAC_ChannelTransfer( DMAC_CHANNEL channel, const void *srcAddr, const void *destAddr, size_t blockSize )
+{
+    uint8_t beatSize;
+    uint16_t btctrl;
+    bool returnStatus = false;
+
+    if((dmacChannelObj[channel].busyStatus == false) && (blockSize != 0U))
+    {
+        dmacChannelObj[channel].busyStatus = true;
+
+        btctrl = descriptor_section[channel].DMAC_BTCTRL;
+
+        /* Set source address */
+        if((btctrl & DMAC_BTCTRL_SRCINC_Msk) == DMAC_BTCTRL_SRCINC_Msk)
+        {
+            descriptor_section[channel].DMAC_SRCADDR = (uint32_t)srcAddr + blockSize;
+        }
+        else
+        {
+            descriptor_section[channel].DMAC_SRCADDR = (uint32_t)srcAddr;
+        }
+
+        /* Set destination address */
+        if((btctrl & DMAC_BTCTRL_DSTINC_Msk) == DMAC_BTCTRL_DSTINC_Msk)
+        {
+            descriptor_section[channel].DMAC_DSTADDR = (uint32_t)destAddr + blockSize;
+        }
+        else
+        {
+            descriptor_section[channel].DMAC_DSTADDR = (uint32_t)destAddr;
+        }
+
+        /* Calculate the beat size and then set the BTCNT value */
+        beatSize = (uint8_t)((btctrl & DMAC_BTCTRL_BEATSIZE_Msk) >> DMAC_BTCTRL_BEATSIZE_Pos);
+
+        /* Set Block Transfer Count */
+        descriptor_section[channel].DMAC_BTCNT = (uint16_t)(blockSize / (1UL << beatSize));
+
+        descriptor_section[channel].DMAC_DESCADDR = 0U;
+
+        /* Clear any stale channel flags before enabling */
+        DMAC_REGS->CHANNEL[channel].DMAC_CHINTFLAG = (uint8_t)(DMAC_CHINTFLAG_TERR_Msk | DMAC_CHINTFLAG_TCMPL_Msk | DMAC_CHINTFLAG_SUSP_Msk);
+
+        /* Make sure the descriptor is written before the channel fetches it */
+        __DMB();
+
+        /* Enable the channel */
+        DMAC_REGS->CHANNEL[channel].DMAC_CHCTRLA |= DMAC_CHCTRLA_ENABLE_Msk;
+
+        returnStatus = true;
+    }
+
+    return returnStatus;
+}
+
+/*******************************************************************************
+    This function starts a linked list transfer. The first descriptor is copied
+    into the channel's descriptor section, the others are fetched by the DMAC
+    through DESCADDR and must be 128-bit aligned. A list that links back on
+    itself keeps the channel running until DMAC_ChannelDisable.
+********************************************************************************/
+
+bool DMAC_ChannelLinkedListTransfer( DMAC_CHANNEL channel, const dmac_descriptor_registers_t* channelDesc )
+{
+    bool returnStatus = false;
+
+    if(dmacChannelObj[channel].busyStatus == false)
+    {
+        dmacChannelObj[channel].busyStatus = true;
+
+        /* Clear any stale channel flags before enabling */
+        DMAC_REGS->CHANNEL[channel].DMAC_CHINTFLAG = (uint8_t)(DMAC_CHINTFLAG_TERR_Msk | DMAC_CHINTFLAG_TCMPL_Msk | DMAC_CHINTFLAG_SUSP_Msk);
+
+        /* Set channel x descriptor 0 to the descriptor base address */
+        (void)memcpy(&descriptor_section[channel], channelDesc, sizeof(dmac_descriptor_registers_t));
+
+        /* Nothing done yet, as DMAC_ChannelRemainingBeatsGet and
+         * DMAC_ChannelNextDescriptorGet see it until the first trigger */
+        (void)memcpy(&write_back_section[channel], channelDesc, sizeof(dmac_descriptor_registers_t));
+
+        /* Make sure the descriptors are written before the channel fetches them */
+        __DMB();
+
+        /* Enable the channel */
+        DMAC_REGS->CHANNEL[channel].DMAC_CHCTRLA |= DMAC_CHCTRLA_ENABLE_Msk;
+
+        returnStatus = true;
+    }
+
+    return returnStatus;
+}
+
+/*******************************************************************************
+    This function issues a software trigger on the channel, as if its trigger
+    source or event input had fired.
+********************************************************************************/
+
+void DMAC_ChannelSoftwareTrigger( DMAC_CHANNEL channel )
+{
+    DMAC_REGS->DMAC_SWTRIGCTRL = (1UL << (uint32_t)channel);
+}
+
+/*******************************************************************************
+    This function returns the status of the channel.
+********************************************************************************/
+
+bool DMAC_ChannelIsBusy( DMAC_CHANNEL channel )
+{
+    return (bool)dmacChannelObj[channel].busyStatus;
+}
+
+/*******************************************************************************
+    These functions return where a channel stands, from its write-back
+    descriptor: the beats left in the block it is on and the descriptor it
+    loads after it. The DMAC updates them each time the channel leaves the
+    active state, so they are current between two bursts.
+********************************************************************************/
+
+uint16_t DMAC_ChannelRemainingBeatsGet( DMAC_CHANNEL channel )
+{
+    return write_back_section[channel].DMAC_BTCNT;
+}
+
+const dmac_descriptor_registers_t* DMAC_ChannelNextDescriptorGet( DMAC_CHANNEL channel )
+{
+    return (const dmac_descriptor_registers_t*)write_back_section[channel].DMAC_DESCADDR;
+}
+
+/*******************************************************************************
+    This function disables the specified DMAC channel, aborting any transfer
+    that is still in progress. No callback is given for an aborted transfer.
+********************************************************************************/
+
+void DMAC_ChannelDisable( DMAC_CHANNEL channel )
+{
+    /* Disable the DMA channel */
+    DMAC_REGS->CHANNEL[channel].DMAC_CHCTRLA &= (~DMAC_CHCTRLA_ENABLE_Msk);
+
+    while((DMAC_REGS->CHANNEL[channel].DMAC_CHCTRLA & DMAC_CHCTRLA_ENABLE_Msk) != 0U)
+    {
+        /* Wait till the channel is disabled */
+    }
+
+    DMAC_REGS->CHANNEL[channel].DMAC_CHINTFLAG = (uint8_t)(DMAC_CHINTFLAG_TERR_Msk | DMAC_CHINTFLAG_TCMPL_Msk | DMAC_CHINTFLAG_SUSP_Msk);
+
+    dmacChannelObj[channel].busyStatus = false;
+}
+
+/*******************************************************************************
+    This function function allows a DMAC PLIB client to set an event handler.
+********************************************************************************/
+
+void DMAC_ChannelCallbackRegister( DMAC_CHANNEL channel, const DMAC_CHANNEL_CALLBACK eventHandler, const uintptr_t contextHandle )
+{
+    dmacChannelObj[channel].callback = eventHandler;
+
+    dmacChannelObj[channel].context  = contextHandle;
+}
+
+/*******************************************************************************
+    This function handles the DMA interrupt events.
+*/
+
+static void DMAC_ChannelInterruptHandler( uint8_t channel )
+{
+    DMAC_CH_OBJECT *dmacChObj = &dmacChannelObj[channel];
+    uint8_t chanIntFlagStatus;
+    DMAC_TRANSFER_EVENT event = DMAC_TRANSFER_EVENT_NONE;
+
+    /* Get the DMAC channel interrupt status */
+    chanIntFlagStatus = DMAC_REGS->CHANNEL[channel].DMAC_CHINTFLAG;
+
+    /* Verify if DMAC Channel Transfer complete flag is set */
+    if((chanIntFlagStatus & DMAC_CHINTFLAG_TCMPL_Msk) == DMAC_CHINTFLAG_TCMPL_Msk)
+    {
+        /* Clear the transfer complete flag */
+        DMAC_REGS->CHANNEL[channel].DMAC_CHINTFLAG = DMAC_CHINTFLAG_TCMPL_Msk;
+
+        event = DMAC_TRANSFER_EVENT_COMPLETE;
+
+        /* A block in the middle of a linked list leaves the channel running */
+        if((DMAC_REGS->CHANNEL[channel].DMAC_CHCTRLA & DMAC_CHCTRLA_ENABLE_Msk) == 0U)
+        {
+            dmacChObj->busyStatus = false;
+        }
+    }
+
+    /* Verify if DMAC Channel Error flag is set */
+    if((chanIntFlagStatus & DMAC_CHINTFLAG_TERR_Msk) == DMAC_CHINTFLAG_TERR_Msk)
+    {
+        /* Clear transfer error flag */
+        DMAC_REGS->CHANNEL[channel].DMAC_CHINTFLAG = DMAC_CHINTFLAG_TERR_Msk;
+
+        event = DMAC_TRANSFER_EVENT_ERROR;
+
+        dmacChObj->busyStatus = false;
+    }
+
+    /* Execute the callback function */
+    if((dmacChObj->callback != NULL) && (event != DMAC_TRANSFER_EVENT_NONE))
+    {
+        dmacChObj->callback(event, dmacChObj->context);
+    }
+}
+
+void DMAC_0_InterruptHandler( void )
+{
+    DMAC_ChannelInterruptHandler(0U);
+}
+
+void DMAC_1_InterruptHandler( void )
+{
+    DMAC_ChannelInterruptHandler(1U);
+}
+
+void DMAC_2_InterruptHandler( void )
+{
+    DMAC_ChannelInterruptHandler(2U);
+}
@@ -0,0 +1,199 @@
+/*******************************************************************************
+  Direct Memory Access Controller (DMAC) PLIB
+
+  Company
+    Microchip Technology Inc.
+
+  File Name
+    plib_dmac.h
+
+  Summary
+    Data Type definition of the DMAC Peripheral Interface Plib.
+
+  Description
+    This file defines the Data Types for the DMAC Plib.
+
+  Remarks:
+    None.
+
+*******************************************************************************/
+
+// DOM-IGNORE-BEGIN
+/*******************************************************************************
+* Copyright (C) 2018 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+// DOM-IGNORE-END
+
+#ifndef PLIB_DMAC_H    // Guards against multiple inclusion
+#define PLIB_DMAC_H
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include "device.h"
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus // Provide C++ Compatibility
+
+    extern "C" {
+
+#endif
+// DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Data Types
+// *****************************************************************************
+// *****************************************************************************
+
+/* Number of DMAC channels configured by this PLIB. Descriptor and write-back
+   memory is only reserved for these. */
+#define DMAC_CHANNELS_NUMBER        5U
+
+// *****************************************************************************
+/* DMAC Channels
+
+  Summary:
+    List of configured DMAC channels.
+
+  Remarks:
+    Channel 0 - SERCOM3 I2C transmit (memory to SERCOM3 DATA)
+    Channel 1 - SERCOM3 I2C receive (SERCOM3 DATA to memory)
+    Channel 2 - SERCOM3 receive, linked list (hardware acquisition chain)
+    Channel 3 - SERCOM3 transmit, linked list (hardware acquisition chain)
+    Channel 4 - EVSYS channel 0 event triggered, linked list (hardware acquisition chain)
+*/
+
+typedef enum
+{
+    DMAC_CHANNEL_0 = 0,
+
+    DMAC_CHANNEL_1 = 1,
+
+    DMAC_CHANNEL_2 = 2,
+
+    DMAC_CHANNEL_3 = 3,
+
+    DMAC_CHANNEL_4 = 4,
+
+} DMAC_CHANNEL;
+
+// *****************************************************************************
+/* DMAC Transfer Events
+
+  Summary:
+    Enumeration of possible DMAC transfer events.
+
+  Description:
+    The transfer event is passed to the channel callback.
+*/
+
+typedef enum
+{
+    /* No event */
+    DMAC_TRANSFER_EVENT_NONE,
+
+    /* Data was transferred successfully. */
+    DMAC_TRANSFER_EVENT_COMPLETE,
+
+    /* Error while processing the request */
+    DMAC_TRANSFER_EVENT_ERROR
+
+} DMAC_TRANSFER_EVENT;
+
+// *****************************************************************************
+/* DMAC Channel Callback
+
+  Summary:
+    Pointer to a DMAC channel transfer event handler function.
+
+  Remarks:
+    Called from the DMAC interrupt context.
+*/
+
+typedef void (*DMAC_CHANNEL_CALLBACK) (DMAC_TRANSFER_EVENT event, uintptr_t contextHandle);
+
+// *****************************************************************************
+/* DMAC Channel Object
+
+  Summary:
+    Fundamental data object for a DMAC channel.
+
+  Remarks:
+    None.
+*/
+
+typedef struct
+{
+    volatile bool                busyStatus;
+
+    DMAC_CHANNEL_CALLBACK        callback;
+
+    uintptr_t                    context;
+
+} DMAC_CH_OBJECT;
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Interface Routines
+// *****************************************************************************
+// *****************************************************************************
+
+void DMAC_Initialize( void );
+
+void DMAC_ChannelCallbackRegister( DMAC_CHANNEL channel, const DMAC_CHANNEL_CALLBACK eventHandler, const uintptr_t contextHandle );
+
+bool DMAC_ChannelTransfer( DMAC_CHANNEL channel, const void *srcAddr, const void *destAddr, size_t blockSize );
+
+bool DMAC_ChannelLinkedListTransfer( DMAC_CHANNEL channel, const dmac_descriptor_registers_t* channelDesc );
+
+void DMAC_ChannelSoftwareTrigger( DMAC_CHANNEL channel );
+
+bool DMAC_ChannelIsBusy( DMAC_CHANNEL channel );
+
+uint16_t DMAC_ChannelRemainingBeatsGet( DMAC_CHANNEL channel );
+
+const dmac_descriptor_registers_t* DMAC_ChannelNextDescriptorGet( DMAC_CHANNEL channel );
+
+void DMAC_ChannelDisable( DMAC_CHANNEL channel );
+
+void DMAC_0_InterruptHandler( void );
+
+void DMAC_1_InterruptHandler( void );
+
+void DMAC_2_InterruptHandler( void );
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    }
+
+#endif
+// DOM-IGNORE-END
+
+#endif //PLIB_DMAC_H
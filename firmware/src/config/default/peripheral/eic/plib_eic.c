@@ -77,7 +77,9 @@ void EIC_Initialize (void)
         /* Wait for sync */
     }
 
-    /* EIC is by default clocked by GCLK */
+    /* EIC is clocked by ULP32K, edge detection and the debouncer keep
+       running in STANDBY so EXTINT7 can wake the device */
+    EIC_REGS->EIC_CTRLA |= (uint8_t)EIC_CTRLA_CKSEL_Msk;
 
     /* NMI Control register */
 
@@ -110,6 +112,9 @@ void EIC_Initialize (void)
     /* Debouncer Setting */
     EIC_REGS->EIC_DPRESCALER = EIC_DPRESCALER_PRESCALER0(0UL) | EIC_DPRESCALER_PRESCALER1(0UL) ;
 
+    /* Event Control Output enable */
+    EIC_REGS->EIC_EVCTRL = 0x80U;
+
     /* External Interrupt enable*/
     EIC_REGS->EIC_INTENSET = 0x80U;
 
@@ -46,8 +46,13 @@
 
 void EVSYS_Initialize( void )
 {
-    /*Event Channel User Configuration*/
+    /* Event Channel 0 Configuration: EIC EXTINT7 (TSL2591 INT) */
+    EVSYS_REGS->CHANNEL[0].EVSYS_CHANNEL = EVSYS_CHANNEL_EVGEN(EVENT_ID_GEN_EIC_EXTINT_7) | EVSYS_CHANNEL_PATH_RESYNCHRONIZED | EVSYS_CHANNEL_EDGSEL_RISING_EDGE \
+                                     | EVSYS_CHANNEL_ONDEMAND(0U) | EVSYS_CHANNEL_RUNSTDBY(0U);
 
+    /*Event Channel User Configuration*/
+    /* DMAC channel 4 starts the hardware acquisition chain, see DRV_TSL2591_ChainStart */
+    EVSYS_REGS->EVSYS_USER[EVENT_ID_USER_DMAC_CH_4] = EVSYS_USER_CHANNEL(0x1U);
 }
 
 
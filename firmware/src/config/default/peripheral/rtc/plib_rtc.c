@@ -0,0 +1,183 @@
+/*******************************************************************************
+  Real Time Counter (RTC) PLIB
+
+  Company
+    Microchip Technology Inc.
+
+  File Name
+    plib_rtc.c
+
+  Summary
+    Source for RTC peripheral library interface Implementation.
+
+  Description
+    This file defines the interface to the RTC peripheral library. This
+    library provides access to and control of the associated peripheral
+    instance.
+
+  Remarks:
+    None.
+
+*******************************************************************************/
+
+// DOM-IGNORE-BEGIN
+/*******************************************************************************
+* Copyright (C) 2018 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+// DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+/* This section lists the other files that are included in this file.
+*/
+
+#include "plib_rtc.h"
+#include "interrupts.h"
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Global Data
+// *****************************************************************************
+// *****************************************************************************
+
+static RTC_OBJECT rtcObj;
+
+
+void RTC_Initialize(void)
+{
+    RTC_REGS->MODE0.RTC_CTRLA = (uint16_t)RTC_MODE0_CTRLA_SWRST_Msk;
+
+    while((RTC_REGS->MODE0.RTC_SYNCBUSY & RTC_MODE0_SYNCBUSY_SWRST_Msk) == RTC_MODE0_SYNCBUSY_SWRST_Msk)
+    {
+        /* Wait for synchronization after Software Reset */
+    }
+
+    /* 32-bit free running counter, COUNT readable without a read request */
+    RTC_REGS->MODE0.RTC_CTRLA = (uint16_t)(RTC_MODE0_CTRLA_MODE_COUNT32 | RTC_MODE0_CTRLA_PRESCALER_DIV1 | RTC_MODE0_CTRLA_COUNTSYNC_Msk);
+
+    while((RTC_REGS->MODE0.RTC_SYNCBUSY & RTC_MODE0_SYNCBUSY_COUNTSYNC_Msk) == RTC_MODE0_SYNCBUSY_COUNTSYNC_Msk)
+    {
+        /* Wait for Synchronization */
+    }
+
+    RTC_REGS->MODE0.RTC_COMP[0] = 0xFFFFFFFFU;
+
+    while((RTC_REGS->MODE0.RTC_SYNCBUSY & RTC_MODE0_SYNCBUSY_COMP0_Msk) == RTC_MODE0_SYNCBUSY_COMP0_Msk)
+    {
+        /* Wait for Synchronization */
+    }
+
+    /* Interrupts are enabled per use, see RTC_Timer32InterruptEnable */
+    RTC_REGS->MODE0.RTC_INTENCLR = (uint16_t)0xFFFFU;
+    RTC_REGS->MODE0.RTC_INTFLAG = (uint16_t)0xFFFFU;
+}
+
+void RTC_Timer32Start ( void )
+{
+    RTC_REGS->MODE0.RTC_CTRLA |= (uint16_t)RTC_MODE0_CTRLA_ENABLE_Msk;
+
+    while((RTC_REGS->MODE0.RTC_SYNCBUSY & RTC_MODE0_SYNCBUSY_ENABLE_Msk) == RTC_MODE0_SYNCBUSY_ENABLE_Msk)
+    {
+        /* Wait for Synchronization */
+    }
+}
+
+void RTC_Timer32Stop ( void )
+{
+    RTC_REGS->MODE0.RTC_CTRLA &= (uint16_t)(~RTC_MODE0_CTRLA_ENABLE_Msk);
+
+    while((RTC_REGS->MODE0.RTC_SYNCBUSY & RTC_MODE0_SYNCBUSY_ENABLE_Msk) == RTC_MODE0_SYNCBUSY_ENABLE_Msk)
+    {
+        /* Wait for Synchronization */
+    }
+}
+
+uint32_t RTC_Timer32CounterGet ( void )
+{
+    while((RTC_REGS->MODE0.RTC_SYNCBUSY & RTC_MODE0_SYNCBUSY_COUNT_Msk) == RTC_MODE0_SYNCBUSY_COUNT_Msk)
+    {
+        /* Wait for Synchronization */
+    }
+
+    return(RTC_REGS->MODE0.RTC_COUNT);
+}
+
+void RTC_Timer32CompareSet ( uint32_t compareValue )
+{
+    RTC_REGS->MODE0.RTC_COMP[0] = compareValue;
+
+    while((RTC_REGS->MODE0.RTC_SYNCBUSY & RTC_MODE0_SYNCBUSY_COMP0_Msk) == RTC_MODE0_SYNCBUSY_COMP0_Msk)
+    {
+        /* Wait for Synchronization */
+    }
+}
+
+uint32_t RTC_Timer32FrequencyGet ( void )
+{
+    return RTC_TIMER32_FREQUENCY;
+}
+
+bool RTC_Timer32CompareHasMatched(void)
+{
+    bool status = false;
+
+    if((RTC_REGS->MODE0.RTC_INTFLAG & RTC_MODE0_INTFLAG_CMP0_Msk) == RTC_MODE0_INTFLAG_CMP0_Msk)
+    {
+        status = true;
+
+        RTC_REGS->MODE0.RTC_INTFLAG = (uint16_t)RTC_MODE0_INTFLAG_CMP0_Msk;
+    }
+
+    return status;
+}
+
+void RTC_Timer32InterruptEnable( RTC_TIMER32_INT_MASK interrupt )
+{
+    RTC_REGS->MODE0.RTC_INTENSET = (uint16_t)interrupt;
+}
+
+void RTC_Timer32InterruptDisable( RTC_TIMER32_INT_MASK interrupt )
+{
+    RTC_REGS->MODE0.RTC_INTENCLR = (uint16_t)interrupt;
+}
+
+void RTC_Timer32CallbackRegister ( RTC_TIMER32_CALLBACK callback, uintptr_t context )
+{
+    rtcObj.timer32BitCallback = callback;
+
+    rtcObj.context = context;
+}
+
+void RTC_InterruptHandler(void)
+{
+    /* Only the enabled causes are reported and cleared */
+    rtcObj.intCause = (RTC_TIMER32_INT_MASK)(RTC_REGS->MODE0.RTC_INTFLAG & RTC_REGS->MODE0.RTC_INTENSET);
+    RTC_REGS->MODE0.RTC_INTFLAG = (uint16_t)rtcObj.intCause;
+
+    if(rtcObj.timer32BitCallback != NULL)
+    {
+        rtcObj.timer32BitCallback(rtcObj.intCause, rtcObj.context);
+    }
+}
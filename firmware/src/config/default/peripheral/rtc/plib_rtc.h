@@ -0,0 +1,140 @@
+/*******************************************************************************
+  Real Time Counter (RTC) PLIB
+
+  Company
+    Microchip Technology Inc.
+
+  File Name
+    plib_rtc.h
+
+  Summary
+    RTC PLIB Header File.
+
+  Description
+    This file defines the interface to the RTC peripheral library, used as a
+    32-bit timer (MODE0) clocked from the 32.768 kHz ULP oscillator. It keeps
+    counting in STANDBY and its compare match wakes the device.
+
+  Remarks:
+    None.
+*******************************************************************************/
+
+// DOM-IGNORE-BEGIN
+/*******************************************************************************
+* Copyright (C) 2018 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+// DOM-IGNORE-END
+
+/* Guards against multiple inclusion */
+#ifndef PLIB_RTC_H
+#define PLIB_RTC_H
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+/* This section lists the other files that are included in this file.
+*/
+
+#include "device.h"
+#include <stdbool.h>
+#include <stddef.h>
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus // Provide C++ Compatibility
+
+    extern "C" {
+
+#endif
+// DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Data Types
+// *****************************************************************************
+// *****************************************************************************
+/* The following data type definitions are used by the functions in this
+    interface and should be considered part of it.
+*/
+
+/* Nominal counter frequency, OSCULP32K with no prescaler */
+#define RTC_TIMER32_FREQUENCY               (32768U)
+
+typedef enum
+{
+    RTC_TIMER32_INT_MASK_CMP0 = 0x0001,
+
+    RTC_TIMER32_INT_MASK_OVF = 0x8000,
+
+} RTC_TIMER32_INT_MASK;
+
+typedef void (*RTC_TIMER32_CALLBACK)(RTC_TIMER32_INT_MASK intCause, uintptr_t context);
+
+typedef struct
+{
+    /* Timer Event Callback */
+    RTC_TIMER32_CALLBACK timer32BitCallback;
+
+    /* Timer Event Callback Context */
+    uintptr_t context;
+
+    /* Interrupt cause */
+    RTC_TIMER32_INT_MASK intCause;
+
+} RTC_OBJECT;
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Interface Routines
+// *****************************************************************************
+// *****************************************************************************
+/* The following functions make up the methods (set of possible operations) of
+   this interface.
+*/
+
+void RTC_Initialize(void);
+
+void RTC_Timer32Start ( void );
+
+void RTC_Timer32Stop ( void );
+
+/* Reads COUNT with read synchronization, stalls for a few RTC clocks */
+uint32_t RTC_Timer32CounterGet ( void );
+
+void RTC_Timer32CompareSet ( uint32_t compareValue );
+
+uint32_t RTC_Timer32FrequencyGet ( void );
+
+/* Polled match check, clears the flag when set */
+bool RTC_Timer32CompareHasMatched(void);
+
+void RTC_Timer32InterruptEnable( RTC_TIMER32_INT_MASK interrupt );
+
+void RTC_Timer32InterruptDisable( RTC_TIMER32_INT_MASK interrupt );
+
+void RTC_Timer32CallbackRegister ( RTC_TIMER32_CALLBACK callback, uintptr_t context );
+
+#ifdef __cplusplus // Provide C++ Compatibility
+}
+#endif
+#endif /* PLIB_RTC_H */
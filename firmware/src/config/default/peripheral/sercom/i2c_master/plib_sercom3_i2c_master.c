@@ -50,6 +50,8 @@
 
 #include "interrupts.h"
 #include "plib_sercom3_i2c_master.h"
+#include "peripheral/dmac/plib_dmac.h"
+#include "peripheral/port/plib_port.h"
 
 
 // *****************************************************************************
@@ -64,9 +66,53 @@
 /* SERCOM3 I2C baud value */
 #define SERCOM3_I2CM_BAUD_VALUE         (0xFFU)
 
+/* SERCOM3 PAD0 (SDA) and PAD1 (SCL), see PORT_Initialize */
+#define SERCOM3_I2C_SDA_PIN             PORT_PIN_PA22
+#define SERCOM3_I2C_SCL_PIN             PORT_PIN_PA23
+#define SERCOM3_I2C_PIN_FUNCTION        PERIPHERAL_FUNCTION_C
+
+/* Bus clear timing in CPU (DWT) cycles at 120 MHz: half an SCL period at
+   100 kHz, and how long a slave may stretch each clock */
+#define SERCOM3_I2C_CLEAR_HALF_CYCLES   600U
+#define SERCOM3_I2C_CLEAR_STRETCH_CYCLES 120000U
+
+
+/* DMAC channels serving SERCOM3, see DMAC_Initialize */
+#define SERCOM3_I2C_DMA_TX_CHANNEL      DMAC_CHANNEL_0
+#define SERCOM3_I2C_DMA_RX_CHANNEL      DMAC_CHANNEL_1
+
+/* ADDR.LEN is 8 bits wide, longer transfers fall back to the byte path */
+#define SERCOM3_I2C_DMA_MAX_LENGTH      255U
+
+/* Vectored writes with more segments fall back to the byte path */
+#define SERCOM3_I2C_DMA_MAX_SEGMENTS    4U
 
 static SERCOM_I2C_OBJ sercom3I2CObj;
 
+/* Set while the current transfer is driven by the DMAC */
+static volatile bool sercom3I2CDmaActive;
+
+/* Transmit descriptor list of a vectored DMA write, one per non-empty segment */
+static dmac_descriptor_registers_t sercom3I2CDmaWriteDesc[SERCOM3_I2C_DMA_MAX_SEGMENTS] __ALIGNED(16) SECTION_DMAC_DESCRIPTOR;
+
+/* The current DMA write is sent from sercom3I2CDmaWriteDesc */
+static bool sercom3I2CDmaWriteList;
+
+/* Register read of the smart variant: the command bytes, then the repeated
+   START of the read phase, both written by the transmit channel */
+static dmac_descriptor_registers_t sercom3I2CSmartTxDesc[2] __ALIGNED(16) SECTION_DMAC_DESCRIPTOR;
+
+/* ADDR value of the read phase, the source of sercom3I2CSmartTxDesc[1] */
+static uint32_t sercom3I2CSmartAddrRead;
+
+static SERCOM_I2C_BENCHMARK sercom3I2CBenchmark;
+
+/* Interrupts taken by the transfer in progress */
+static uint32_t sercom3I2CXferInterrupts;
+
+static void SERCOM3_I2C_DMA_TxCallback(DMAC_TRANSFER_EVENT event, uintptr_t context);
+static void SERCOM3_I2C_DMA_RxCallback(DMAC_TRANSFER_EVENT event, uintptr_t context);
+
 // *****************************************************************************
 // *****************************************************************************
 // Section: SERCOM3 I2C Implementation
@@ -118,6 +164,13 @@ void SERCOM3_I2C_Initialize(void)
     /* Initialize the SERCOM3 PLib Object */
     sercom3I2CObj.error = SERCOM_I2C_ERROR_NONE;
     sercom3I2CObj.state = SERCOM_I2C_STATE_IDLE;
+    sercom3I2CObj.writeSegmentCount = 0U;
+    sercom3I2CDmaActive = false;
+    sercom3I2CXferInterrupts = 0U;
+
+    /* DMAC completions for the DMA transfer path, DMAC_Initialize must run first */
+    DMAC_ChannelCallbackRegister(SERCOM3_I2C_DMA_TX_CHANNEL, SERCOM3_I2C_DMA_TxCallback, 0U);
+    DMAC_ChannelCallbackRegister(SERCOM3_I2C_DMA_RX_CHANNEL, SERCOM3_I2C_DMA_RxCallback, 0U);
 
     /* Enable all Interrupts */
     SERCOM3_REGS->I2CM.SERCOM_INTENSET = (uint8_t)SERCOM_I2CM_INTENSET_Msk;
@@ -317,7 +370,9 @@ static bool SERCOM3_I2C_XferSetup(
     uint8_t* rdData,
     uint32_t rdLength,
     bool dir,
-    bool isHighSpeed
+    bool isHighSpeed,
+    const SERCOM_I2C_SEGMENT* wrSegments,
+    uint32_t wrSegmentCount
 )
 {
     /* Check for ongoing transfer */
@@ -331,6 +386,8 @@ static bool SERCOM3_I2C_XferSetup(
     sercom3I2CObj.readSize       = rdLength;
     sercom3I2CObj.writeBuffer    = wrData;
     sercom3I2CObj.writeSize      = wrLength;
+    sercom3I2CObj.writeSegments  = wrSegments;
+    sercom3I2CObj.writeSegmentCount = wrSegmentCount;
     sercom3I2CObj.transferDir    = dir;
     sercom3I2CObj.isHighSpeed    = isHighSpeed;
     sercom3I2CObj.error          = SERCOM_I2C_ERROR_NONE;
@@ -343,17 +400,35 @@ static bool SERCOM3_I2C_XferSetup(
 
 bool SERCOM3_I2C_Read(uint16_t address, uint8_t* rdData, uint32_t rdLength)
 {
-    return SERCOM3_I2C_XferSetup(address, NULL, 0, rdData, rdLength, true, false);
+    return SERCOM3_I2C_XferSetup(address, NULL, 0, rdData, rdLength, true, false, NULL, 0U);
 }
 
 bool SERCOM3_I2C_Write(uint16_t address, uint8_t* wrData, uint32_t wrLength)
 {
-    return SERCOM3_I2C_XferSetup(address, wrData, wrLength, NULL, 0, false, false);
+    return SERCOM3_I2C_XferSetup(address, wrData, wrLength, NULL, 0, false, false, NULL, 0U);
 }
 
 bool SERCOM3_I2C_WriteRead(uint16_t address, uint8_t* wrData, uint32_t wrLength, uint8_t* rdData, uint32_t rdLength)
 {
-    return SERCOM3_I2C_XferSetup(address, wrData, wrLength, rdData, rdLength, false, false);
+    return SERCOM3_I2C_XferSetup(address, wrData, wrLength, rdData, rdLength, false, false, NULL, 0U);
+}
+
+bool SERCOM3_I2C_WriteVector(uint16_t address, const SERCOM_I2C_SEGMENT* segments, uint32_t segmentCount)
+{
+    /* Start with the first non-empty segment, the interrupt handler moves on
+       to the next ones as each runs out */
+    while((segmentCount != 0U) && (segments->length == 0U))
+    {
+        segments++;
+        segmentCount--;
+    }
+
+    if(segmentCount == 0U)
+    {
+        return false;
+    }
+
+    return SERCOM3_I2C_XferSetup(address, segments->buffer, segments->length, NULL, 0, false, false, &segments[1], segmentCount - 1U);
 }
 
 
@@ -382,6 +457,14 @@ void SERCOM3_I2C_TransferAbort( void )
     // Reset the plib to IDLE state
     sercom3I2CObj.state = SERCOM_I2C_STATE_IDLE;
 
+    if(sercom3I2CDmaActive)
+    {
+        DMAC_ChannelDisable(SERCOM3_I2C_DMA_TX_CHANNEL);
+        DMAC_ChannelDisable(SERCOM3_I2C_DMA_RX_CHANNEL);
+        sercom3I2CDmaActive = false;
+        SERCOM3_REGS->I2CM.SERCOM_INTENSET = (uint8_t)SERCOM_I2CM_INTENSET_Msk;
+    }
+
     /* Disable the I2C module */
     SERCOM3_REGS->I2CM.SERCOM_CTRLA &= ~SERCOM_I2CM_CTRLA_ENABLE_Msk;
 
@@ -410,7 +493,531 @@ void SERCOM3_I2C_TransferAbort( void )
     }
 }
 
-void SERCOM3_I2C_InterruptHandler(void)
+static void SERCOM3_I2C_TransferCount(void)
+{
+    sercom3I2CBenchmark.transfers++;
+    sercom3I2CBenchmark.lastTransferInterrupts = sercom3I2CXferInterrupts;
+
+    if(sercom3I2CXferInterrupts > sercom3I2CBenchmark.maxTransferInterrupts)
+    {
+        sercom3I2CBenchmark.maxTransferInterrupts = sercom3I2CXferInterrupts;
+    }
+
+    sercom3I2CXferInterrupts = 0U;
+}
+
+static void SERCOM3_I2C_BusClearDelay(uint32_t cycles)
+{
+    uint32_t start = DWT->CYCCNT;
+
+    while((DWT->CYCCNT - start) < cycles)
+    {
+        /* Do nothing */
+    }
+}
+
+bool SERCOM3_I2C_BusRecover(void)
+{
+    uint32_t clock;
+    uint32_t start;
+    bool sdaReleased;
+
+    /* Stop any transfer and take the pins away from the SERCOM */
+    SERCOM3_I2C_TransferAbort();
+
+    SERCOM3_REGS->I2CM.SERCOM_CTRLA &= ~SERCOM_I2CM_CTRLA_ENABLE_Msk;
+
+    /* Wait for synchronization */
+    while((SERCOM3_REGS->I2CM.SERCOM_SYNCBUSY) != 0U)
+    {
+        /* Do nothing */
+    }
+
+    /* Open drain by hand: a line is driven low as an output and released as
+       an input, the bus pull-ups bring it high */
+    PORT_PinClear(SERCOM3_I2C_SDA_PIN);
+    PORT_PinClear(SERCOM3_I2C_SCL_PIN);
+    PORT_PinInputEnable(SERCOM3_I2C_SDA_PIN);
+    PORT_PinInputEnable(SERCOM3_I2C_SCL_PIN);
+    PORT_PinGPIOConfig(SERCOM3_I2C_SDA_PIN);
+    PORT_PinGPIOConfig(SERCOM3_I2C_SCL_PIN);
+
+    /* Up to 9 clocks let a slave that is holding SDA low in the middle of a
+       byte finish it, and see a NACK in place of its ACK */
+    for(clock = 0U; (clock < 9U) && !PORT_PinRead(SERCOM3_I2C_SDA_PIN); clock++)
+    {
+        PORT_PinOutputEnable(SERCOM3_I2C_SCL_PIN);
+        SERCOM3_I2C_BusClearDelay(SERCOM3_I2C_CLEAR_HALF_CYCLES);
+
+        PORT_PinInputEnable(SERCOM3_I2C_SCL_PIN);
+
+        start = DWT->CYCCNT;
+        while(!PORT_PinRead(SERCOM3_I2C_SCL_PIN) && ((DWT->CYCCNT - start) < SERCOM3_I2C_CLEAR_STRETCH_CYCLES))
+        {
+            /* Clock stretching */
+        }
+
+        SERCOM3_I2C_BusClearDelay(SERCOM3_I2C_CLEAR_HALF_CYCLES);
+    }
+
+    /* STOP: SDA rises while SCL is high */
+    PORT_PinOutputEnable(SERCOM3_I2C_SCL_PIN);
+    SERCOM3_I2C_BusClearDelay(SERCOM3_I2C_CLEAR_HALF_CYCLES);
+    PORT_PinOutputEnable(SERCOM3_I2C_SDA_PIN);
+    SERCOM3_I2C_BusClearDelay(SERCOM3_I2C_CLEAR_HALF_CYCLES);
+    PORT_PinInputEnable(SERCOM3_I2C_SCL_PIN);
+    SERCOM3_I2C_BusClearDelay(SERCOM3_I2C_CLEAR_HALF_CYCLES);
+    PORT_PinInputEnable(SERCOM3_I2C_SDA_PIN);
+    SERCOM3_I2C_BusClearDelay(SERCOM3_I2C_CLEAR_HALF_CYCLES);
+
+    sdaReleased = PORT_PinRead(SERCOM3_I2C_SDA_PIN) && PORT_PinRead(SERCOM3_I2C_SCL_PIN);
+
+    /* Hand the pins back and start the SERCOM from its reset configuration */
+    PORT_PinPeripheralFunctionConfig(SERCOM3_I2C_SDA_PIN, SERCOM3_I2C_PIN_FUNCTION);
+    PORT_PinPeripheralFunctionConfig(SERCOM3_I2C_SCL_PIN, SERCOM3_I2C_PIN_FUNCTION);
+
+    SERCOM3_I2C_Initialize();
+
+    return sdaReleased;
+}
+
+static void SERCOM3_I2C_TransferFinish(void)
+{
+    /* Error Status */
+    if(sercom3I2CObj.state == SERCOM_I2C_STATE_ERROR)
+    {
+        /* Reset the PLib objects and Interrupts */
+        sercom3I2CObj.state = SERCOM_I2C_STATE_IDLE;
+
+        if(sercom3I2CDmaActive)
+        {
+            /* Stop the DMAC from touching DATA before the STOP goes out */
+            DMAC_ChannelDisable(SERCOM3_I2C_DMA_TX_CHANNEL);
+            DMAC_ChannelDisable(SERCOM3_I2C_DMA_RX_CHANNEL);
+        }
+
+        /* Generate STOP condition */
+        SERCOM3_REGS->I2CM.SERCOM_CTRLB |= SERCOM_I2CM_CTRLB_CMD(3UL);
+
+        /* Wait for synchronization */
+        while((SERCOM3_REGS->I2CM.SERCOM_SYNCBUSY) != 0U)
+        {
+            /* Do nothing */
+        }
+
+
+        SERCOM3_REGS->I2CM.SERCOM_INTFLAG = (uint8_t)SERCOM_I2CM_INTFLAG_Msk;
+
+        if(sercom3I2CDmaActive)
+        {
+            /* Back to the byte path interrupt set */
+            sercom3I2CDmaActive = false;
+            SERCOM3_REGS->I2CM.SERCOM_INTENSET = (uint8_t)SERCOM_I2CM_INTENSET_Msk;
+        }
+
+        SERCOM3_I2C_TransferCount();
+
+        if (sercom3I2CObj.callback != NULL)
+        {
+            sercom3I2CObj.callback(sercom3I2CObj.context);
+        }
+    }
+    /* Transfer Complete */
+    else if(sercom3I2CObj.state == SERCOM_I2C_STATE_TRANSFER_DONE)
+    {
+        /* Reset the PLib objects and interrupts */
+        sercom3I2CObj.state = SERCOM_I2C_STATE_IDLE;
+        sercom3I2CObj.error = SERCOM_I2C_ERROR_NONE;
+
+        SERCOM3_REGS->I2CM.SERCOM_INTFLAG = (uint8_t)SERCOM_I2CM_INTFLAG_Msk;
+
+        /* Wait for the NAK and STOP bit to be transmitted out and I2C state machine to rest in IDLE state */
+        while((SERCOM3_REGS->I2CM.SERCOM_STATUS & SERCOM_I2CM_STATUS_BUSSTATE_Msk) != SERCOM_I2CM_STATUS_BUSSTATE(0x01U))
+        {
+            /* Do nothing */
+        }
+
+        if(sercom3I2CDmaActive)
+        {
+            /* Back to the byte path interrupt set */
+            sercom3I2CDmaActive = false;
+            SERCOM3_REGS->I2CM.SERCOM_INTENSET = (uint8_t)SERCOM_I2CM_INTENSET_Msk;
+        }
+
+        SERCOM3_I2C_TransferCount();
+
+        if(sercom3I2CObj.callback != NULL)
+        {
+            sercom3I2CObj.callback(sercom3I2CObj.context);
+        }
+
+    }
+    else
+    {
+        /* Do nothing */
+    }
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: SERCOM3 I2C DMA Implementation
+// *****************************************************************************
+// *****************************************************************************
+/* The DMAC moves the data bytes and ADDR.LENEN lets the SERCOM send the
+   NACK/STOP on its own, so the CPU only sees the end of each phase:
+   read - 1 interrupt, write - 2, writeRead - 3 (the write phase ends with a
+   STOP and the read phase starts with a new START). */
+
+static void SERCOM3_I2C_DMA_StartWrite(void)
+{
+    sercom3I2CObj.state = SERCOM_I2C_STATE_DMA_WRITE;
+
+    if(sercom3I2CDmaWriteList)
+    {
+        (void)DMAC_ChannelLinkedListTransfer(SERCOM3_I2C_DMA_TX_CHANNEL, &sercom3I2CDmaWriteDesc[0]);
+    }
+    else
+    {
+        (void)DMAC_ChannelTransfer(SERCOM3_I2C_DMA_TX_CHANNEL, sercom3I2CObj.writeBuffer, (const void *)&SERCOM3_REGS->I2CM.SERCOM_DATA, sercom3I2CObj.writeSize);
+    }
+
+    SERCOM3_REGS->I2CM.SERCOM_ADDR = ((uint32_t)sercom3I2CObj.address << 1U) | (uint32_t)I2C_TRANSFER_WRITE | SERCOM_I2CM_ADDR_LENEN_Msk | SERCOM_I2CM_ADDR_LEN(sercom3I2CObj.writeSize);
+
+    /* Wait for synchronization */
+    while((SERCOM3_REGS->I2CM.SERCOM_SYNCBUSY) != 0U)
+    {
+        /* Do nothing */
+    }
+}
+
+static void SERCOM3_I2C_DMA_StartRead(void)
+{
+    sercom3I2CObj.state = SERCOM_I2C_STATE_DMA_READ;
+
+    (void)DMAC_ChannelTransfer(SERCOM3_I2C_DMA_RX_CHANNEL, (const void *)&SERCOM3_REGS->I2CM.SERCOM_DATA, sercom3I2CObj.readBuffer, sercom3I2CObj.readSize);
+
+    SERCOM3_REGS->I2CM.SERCOM_ADDR = ((uint32_t)sercom3I2CObj.address << 1U) | (uint32_t)I2C_TRANSFER_READ | SERCOM_I2CM_ADDR_LENEN_Msk | SERCOM_I2CM_ADDR_LEN(sercom3I2CObj.readSize);
+
+    /* Wait for synchronization */
+    while((SERCOM3_REGS->I2CM.SERCOM_SYNCBUSY) != 0U)
+    {
+        /* Do nothing */
+    }
+}
+
+static void SERCOM3_I2C_DMA_TxCallback(DMAC_TRANSFER_EVENT event, uintptr_t context)
+{
+    uint32_t start = DWT->CYCCNT;
+
+    sercom3I2CXferInterrupts++;
+
+    if(event == DMAC_TRANSFER_EVENT_COMPLETE)
+    {
+        /* The last byte is in DATA, wake up once it has been shifted out */
+        sercom3I2CObj.state = SERCOM_I2C_STATE_DMA_WRITE_LAST;
+        SERCOM3_REGS->I2CM.SERCOM_INTENSET = (uint8_t)SERCOM_I2CM_INTENSET_MB_Msk;
+    }
+    else
+    {
+        sercom3I2CObj.state = SERCOM_I2C_STATE_ERROR;
+        sercom3I2CObj.error = SERCOM_I2C_ERROR_BUS;
+        SERCOM3_I2C_TransferFinish();
+    }
+
+    sercom3I2CBenchmark.interrupts++;
+    sercom3I2CBenchmark.cycles += DWT->CYCCNT - start;
+}
+
+static void SERCOM3_I2C_DMA_RxCallback(DMAC_TRANSFER_EVENT event, uintptr_t context)
+{
+    uint32_t start = DWT->CYCCNT;
+
+    sercom3I2CXferInterrupts++;
+
+    if(event == DMAC_TRANSFER_EVENT_COMPLETE)
+    {
+        /* All bytes are in memory, LENEN has sent the NACK and STOP */
+        sercom3I2CObj.state = SERCOM_I2C_STATE_TRANSFER_DONE;
+
+        /* A smart register read leaves its transmit list without an
+           interrupt, it has run to the end before the first byte came in */
+        if(DMAC_ChannelIsBusy(SERCOM3_I2C_DMA_TX_CHANNEL))
+        {
+            DMAC_ChannelDisable(SERCOM3_I2C_DMA_TX_CHANNEL);
+        }
+    }
+    else
+    {
+        sercom3I2CObj.state = SERCOM_I2C_STATE_ERROR;
+        sercom3I2CObj.error = SERCOM_I2C_ERROR_BUS;
+    }
+
+    SERCOM3_I2C_TransferFinish();
+
+    sercom3I2CBenchmark.interrupts++;
+    sercom3I2CBenchmark.cycles += DWT->CYCCNT - start;
+}
+
+static void SERCOM3_I2C_DMA_WriteListBuild(const SERCOM_I2C_SEGMENT* segments, uint32_t segmentCount)
+{
+    dmac_descriptor_registers_t* desc = NULL;
+    uint32_t i;
+    uint32_t count = 0U;
+
+    for(i = 0U; i < segmentCount; i++)
+    {
+        if(segments[i].length == 0U)
+        {
+            continue;
+        }
+
+        if(desc != NULL)
+        {
+            desc->DMAC_DESCADDR = (uint32_t)&sercom3I2CDmaWriteDesc[count];
+        }
+
+        desc = &sercom3I2CDmaWriteDesc[count];
+        count++;
+
+        /* Source end address, the DMAC counts backwards from it */
+        desc->DMAC_BTCTRL = (uint16_t)(DMAC_BTCTRL_VALID_Msk | DMAC_BTCTRL_BEATSIZE_BYTE | DMAC_BTCTRL_SRCINC_Msk | DMAC_BTCTRL_BLOCKACT_NOACT);
+        desc->DMAC_BTCNT = (uint16_t)segments[i].length;
+        desc->DMAC_SRCADDR = (uint32_t)segments[i].buffer + segments[i].length;
+        desc->DMAC_DSTADDR = (uint32_t)&SERCOM3_REGS->I2CM.SERCOM_DATA;
+        desc->DMAC_DESCADDR = 0U;
+    }
+
+    /* Only the end of the list raises the channel interrupt */
+    desc->DMAC_BTCTRL |= (uint16_t)DMAC_BTCTRL_BLOCKACT_INT;
+}
+
+static bool SERCOM3_I2C_DMA_XferSetup(
+    uint16_t address,
+    uint8_t* wrData,
+    uint32_t wrLength,
+    uint8_t* rdData,
+    uint32_t rdLength,
+    const SERCOM_I2C_SEGMENT* wrSegments,
+    uint32_t wrSegmentCount
+)
+{
+    /* Zero length and over long transfers can not be expressed with ADDR.LEN */
+    if((wrLength > SERCOM3_I2C_DMA_MAX_LENGTH) || (rdLength > SERCOM3_I2C_DMA_MAX_LENGTH) || ((wrLength == 0U) && (rdLength == 0U)) ||
+       (wrSegmentCount > SERCOM3_I2C_DMA_MAX_SEGMENTS))
+    {
+        if(wrSegments != NULL)
+        {
+            return SERCOM3_I2C_WriteVector(address, wrSegments, wrSegmentCount);
+        }
+
+        return SERCOM3_I2C_XferSetup(address, wrData, wrLength, rdData, rdLength, (wrLength == 0U), false, NULL, 0U);
+    }
+
+    /* Check for ongoing transfer */
+    if((sercom3I2CObj.state != SERCOM_I2C_STATE_IDLE) || DMAC_ChannelIsBusy(SERCOM3_I2C_DMA_TX_CHANNEL) || DMAC_ChannelIsBusy(SERCOM3_I2C_DMA_RX_CHANNEL))
+    {
+        return false;
+    }
+
+    sercom3I2CObj.address        = address;
+    sercom3I2CObj.readBuffer     = rdData;
+    sercom3I2CObj.readSize       = rdLength;
+    sercom3I2CObj.writeBuffer    = wrData;
+    sercom3I2CObj.writeSize      = wrLength;
+    sercom3I2CObj.writeCount     = 0U;
+    sercom3I2CObj.readCount      = 0U;
+    sercom3I2CObj.transferDir    = (wrLength == 0U);
+    sercom3I2CObj.isHighSpeed    = false;
+    sercom3I2CObj.error          = SERCOM_I2C_ERROR_NONE;
+
+    /* The descriptors are only touched once the channel is known to be idle */
+    sercom3I2CDmaWriteList = (wrSegments != NULL);
+
+    if(sercom3I2CDmaWriteList)
+    {
+        SERCOM3_I2C_DMA_WriteListBuild(wrSegments, wrSegmentCount);
+    }
+
+    sercom3I2CDmaActive = true;
+
+    /* MB/SB now trigger the DMAC, the CPU only needs the error interrupt */
+    SERCOM3_REGS->I2CM.SERCOM_INTENCLR = (uint8_t)(SERCOM_I2CM_INTENCLR_MB_Msk | SERCOM_I2CM_INTENCLR_SB_Msk);
+
+    /* Clear all flags */
+    SERCOM3_REGS->I2CM.SERCOM_INTFLAG = (uint8_t)SERCOM_I2CM_INTFLAG_Msk;
+
+    /* Smart mode enabled with SCLSM = 0, - ACK is set to send while receiving the data */
+    SERCOM3_REGS->I2CM.SERCOM_CTRLB &= ~SERCOM_I2CM_CTRLB_ACKACT_Msk;
+
+    /* Wait for synchronization */
+    while((SERCOM3_REGS->I2CM.SERCOM_SYNCBUSY) != 0U)
+    {
+        /* Do nothing */
+    }
+
+    if(wrLength != 0U)
+    {
+        SERCOM3_I2C_DMA_StartWrite();
+    }
+    else
+    {
+        SERCOM3_I2C_DMA_StartRead();
+    }
+
+    return true;
+}
+
+bool SERCOM3_I2C_DMA_Read(uint16_t address, uint8_t* rdData, uint32_t rdLength)
+{
+    return SERCOM3_I2C_DMA_XferSetup(address, NULL, 0, rdData, rdLength, NULL, 0U);
+}
+
+bool SERCOM3_I2C_DMA_Write(uint16_t address, uint8_t* wrData, uint32_t wrLength)
+{
+    return SERCOM3_I2C_DMA_XferSetup(address, wrData, wrLength, NULL, 0, NULL, 0U);
+}
+
+bool SERCOM3_I2C_DMA_WriteRead(uint16_t address, uint8_t* wrData, uint32_t wrLength, uint8_t* rdData, uint32_t rdLength)
+{
+    return SERCOM3_I2C_DMA_XferSetup(address, wrData, wrLength, rdData, rdLength, NULL, 0U);
+}
+
+bool SERCOM3_I2C_DMA_WriteVector(uint16_t address, const SERCOM_I2C_SEGMENT* segments, uint32_t segmentCount)
+{
+    uint32_t i;
+    uint32_t length = 0U;
+
+    /* One transaction of the summed length, one descriptor per segment */
+    for(i = 0U; i < segmentCount; i++)
+    {
+        length += segments[i].length;
+    }
+
+    if(length == 0U)
+    {
+        return false;
+    }
+
+    return SERCOM3_I2C_DMA_XferSetup(address, NULL, length, NULL, 0, segments, segmentCount);
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: SERCOM3 I2C Smart Register Read Implementation
+// *****************************************************************************
+// *****************************************************************************
+/* Fixed length register reads (command bytes, STOP, START, read) with a
+   single interrupt. ADDR.LENEN on the write phase has the SERCOM send the
+   STOP after the command bytes, and a NACK of the address or of a command
+   byte ends it early with LENERR, which raises the ERROR interrupt and is
+   reported as SERCOM_I2C_ERROR_NAK. The transmit channel, paced by MB,
+   writes the command bytes and then the read address to ADDR, which issues
+   the START without the CPU. Smart mode (CTRLB.SMEN, ACKACT = 0) ACKs
+   every byte as the receive channel takes it out of DATA, and ADDR.LENEN
+   has the SERCOM NACK the last byte and send the STOP. Only the end of the
+   receive channel, or an error, interrupts the CPU. */
+
+bool SERCOM3_I2C_SMART_WriteRead(uint16_t address, uint8_t* wrData, uint32_t wrLength, uint8_t* rdData, uint32_t rdLength)
+{
+    dmac_descriptor_registers_t* desc;
+
+    /* Anything that is not a register read goes through the DMA path */
+    if((wrLength == 0U) || (rdLength == 0U) || (wrLength > SERCOM3_I2C_DMA_MAX_LENGTH) || (rdLength > SERCOM3_I2C_DMA_MAX_LENGTH))
+    {
+        return SERCOM3_I2C_DMA_WriteRead(address, wrData, wrLength, rdData, rdLength);
+    }
+
+    /* Check for ongoing transfer */
+    if((sercom3I2CObj.state != SERCOM_I2C_STATE_IDLE) || DMAC_ChannelIsBusy(SERCOM3_I2C_DMA_TX_CHANNEL) || DMAC_ChannelIsBusy(SERCOM3_I2C_DMA_RX_CHANNEL))
+    {
+        return false;
+    }
+
+    sercom3I2CObj.address        = address;
+    sercom3I2CObj.readBuffer     = rdData;
+    sercom3I2CObj.readSize       = rdLength;
+    sercom3I2CObj.writeBuffer    = wrData;
+    sercom3I2CObj.writeSize      = wrLength;
+    sercom3I2CObj.writeCount     = 0U;
+    sercom3I2CObj.readCount      = 0U;
+    sercom3I2CObj.transferDir    = false;
+    sercom3I2CObj.isHighSpeed    = false;
+    sercom3I2CObj.error          = SERCOM_I2C_ERROR_NONE;
+
+    sercom3I2CSmartAddrRead = ((uint32_t)address << 1U) | (uint32_t)I2C_TRANSFER_READ | SERCOM_I2CM_ADDR_LENEN_Msk | SERCOM_I2CM_ADDR_LEN(rdLength);
+
+    /* Command bytes, source end address as the DMAC counts backwards from it */
+    desc = &sercom3I2CSmartTxDesc[0];
+    desc->DMAC_BTCTRL = (uint16_t)(DMAC_BTCTRL_VALID_Msk | DMAC_BTCTRL_BEATSIZE_BYTE | DMAC_BTCTRL_SRCINC_Msk | DMAC_BTCTRL_BLOCKACT_NOACT);
+    desc->DMAC_BTCNT = (uint16_t)wrLength;
+    desc->DMAC_SRCADDR = (uint32_t)wrData + wrLength;
+    desc->DMAC_DSTADDR = (uint32_t)&SERCOM3_REGS->I2CM.SERCOM_DATA;
+    desc->DMAC_DESCADDR = (uint32_t)&sercom3I2CSmartTxDesc[1];
+
+    /* Read address, taken on the MB that follows the last command byte */
+    desc = &sercom3I2CSmartTxDesc[1];
+    desc->DMAC_BTCTRL = (uint16_t)(DMAC_BTCTRL_VALID_Msk | DMAC_BTCTRL_BEATSIZE_WORD | DMAC_BTCTRL_BLOCKACT_NOACT);
+    desc->DMAC_BTCNT = 1U;
+    desc->DMAC_SRCADDR = (uint32_t)&sercom3I2CSmartAddrRead;
+    desc->DMAC_DSTADDR = (uint32_t)&SERCOM3_REGS->I2CM.SERCOM_ADDR;
+    desc->DMAC_DESCADDR = 0U;
+
+    sercom3I2CDmaActive = true;
+    sercom3I2CObj.state = SERCOM_I2C_STATE_DMA_READ;
+
+    /* MB/SB now trigger the DMAC, the CPU only needs the error interrupt */
+    SERCOM3_REGS->I2CM.SERCOM_INTENCLR = (uint8_t)(SERCOM_I2CM_INTENCLR_MB_Msk | SERCOM_I2CM_INTENCLR_SB_Msk);
+
+    /* Clear all flags */
+    SERCOM3_REGS->I2CM.SERCOM_INTFLAG = (uint8_t)SERCOM_I2CM_INTFLAG_Msk;
+
+    /* Smart mode enabled with SCLSM = 0, - ACK is set to send while receiving the data */
+    SERCOM3_REGS->I2CM.SERCOM_CTRLB &= ~SERCOM_I2CM_CTRLB_ACKACT_Msk;
+
+    /* Wait for synchronization */
+    while((SERCOM3_REGS->I2CM.SERCOM_SYNCBUSY) != 0U)
+    {
+        /* Do nothing */
+    }
+
+    (void)DMAC_ChannelTransfer(SERCOM3_I2C_DMA_RX_CHANNEL, (const void *)&SERCOM3_REGS->I2CM.SERCOM_DATA, rdData, rdLength);
+    (void)DMAC_ChannelLinkedListTransfer(SERCOM3_I2C_DMA_TX_CHANNEL, &sercom3I2CSmartTxDesc[0]);
+
+    /* Write phase with LENEN, a NACK before the last command byte sets LENERR */
+    SERCOM3_REGS->I2CM.SERCOM_ADDR = ((uint32_t)address << 1U) | (uint32_t)I2C_TRANSFER_WRITE | SERCOM_I2CM_ADDR_LENEN_Msk | SERCOM_I2CM_ADDR_LEN(wrLength);
+
+    /* Wait for synchronization */
+    while((SERCOM3_REGS->I2CM.SERCOM_SYNCBUSY) != 0U)
+    {
+        /* Do nothing */
+    }
+
+    return true;
+}
+
+void SERCOM3_I2C_BenchmarkGet(SERCOM_I2C_BENCHMARK* benchmark)
+{
+    benchmark->interrupts = sercom3I2CBenchmark.interrupts;
+    benchmark->cycles = sercom3I2CBenchmark.cycles;
+    benchmark->transfers = sercom3I2CBenchmark.transfers;
+    benchmark->lastTransferInterrupts = sercom3I2CBenchmark.lastTransferInterrupts;
+    benchmark->maxTransferInterrupts = sercom3I2CBenchmark.maxTransferInterrupts;
+}
+
+void SERCOM3_I2C_BenchmarkReset(void)
+{
+    /* Make sure the DWT cycle counter is running */
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    sercom3I2CBenchmark.interrupts = 0U;
+    sercom3I2CBenchmark.cycles = 0U;
+    sercom3I2CBenchmark.transfers = 0U;
+    sercom3I2CBenchmark.lastTransferInterrupts = 0U;
+    sercom3I2CBenchmark.maxTransferInterrupts = 0U;
+}
+
+static void SERCOM3_I2C_TransferHandler(void)
 {
     if(SERCOM3_REGS->I2CM.SERCOM_INTENSET != 0U)
     {
@@ -419,7 +1026,7 @@ void SERCOM3_I2C_InterruptHandler(void)
         {
             /* Set Error status */
             sercom3I2CObj.state = SERCOM_I2C_STATE_ERROR;
-            sercom3I2CObj.error = SERCOM_I2C_ERROR_BUS;
+            sercom3I2CObj.error = SERCOM_I2C_ERROR_ARBITRATION_LOST;
 
         }
         /* Check for Bus Error during transmission */
@@ -435,6 +1042,12 @@ void SERCOM3_I2C_InterruptHandler(void)
             sercom3I2CObj.state = SERCOM_I2C_STATE_ERROR;
             sercom3I2CObj.error = SERCOM_I2C_ERROR_NAK;
         }
+        /* Slave NACKed before ADDR.LEN bytes were written by the DMAC */
+        else if((SERCOM3_REGS->I2CM.SERCOM_STATUS & SERCOM_I2CM_STATUS_LENERR_Msk) == SERCOM_I2CM_STATUS_LENERR_Msk)
+        {
+            sercom3I2CObj.state = SERCOM_I2C_STATE_ERROR;
+            sercom3I2CObj.error = SERCOM_I2C_ERROR_NAK;
+        }
         else
         {
             switch(sercom3I2CObj.state)
@@ -463,6 +1076,16 @@ void SERCOM3_I2C_InterruptHandler(void)
 
                 case SERCOM_I2C_STATE_TRANSFER_WRITE:
 
+                    /* Continue a vectored write with its next segment */
+                    while ((sercom3I2CObj.writeCount == sercom3I2CObj.writeSize) && (sercom3I2CObj.writeSegmentCount != 0U))
+                    {
+                        sercom3I2CObj.writeBuffer = sercom3I2CObj.writeSegments->buffer;
+                        sercom3I2CObj.writeSize = sercom3I2CObj.writeSegments->length;
+                        sercom3I2CObj.writeCount = 0U;
+                        sercom3I2CObj.writeSegments++;
+                        sercom3I2CObj.writeSegmentCount--;
+                    }
+
                     if (sercom3I2CObj.writeCount == (sercom3I2CObj.writeSize))
                     {
                         if(sercom3I2CObj.readSize != 0U)
@@ -536,62 +1159,62 @@ void SERCOM3_I2C_InterruptHandler(void)
 
                     break;
 
-                default:
+                case SERCOM_I2C_STATE_DMA_WRITE_LAST:
 
-                    /* Do nothing */
-                    break;
-            }
-        }
+                    /* Last byte is out and ACKed, LENEN has already sent the STOP */
+                    SERCOM3_REGS->I2CM.SERCOM_INTENCLR = (uint8_t)SERCOM_I2CM_INTENCLR_MB_Msk;
 
-        /* Error Status */
-        if(sercom3I2CObj.state == SERCOM_I2C_STATE_ERROR)
-        {
-            /* Reset the PLib objects and Interrupts */
-            sercom3I2CObj.state = SERCOM_I2C_STATE_IDLE;
+                    if(sercom3I2CObj.readSize != 0U)
+                    {
+                        SERCOM3_I2C_DMA_StartRead();
+                    }
+                    else
+                    {
+                        if((SERCOM3_REGS->I2CM.SERCOM_STATUS & SERCOM_I2CM_STATUS_BUSSTATE_Msk) == SERCOM_I2CM_STATUS_BUSSTATE(0x02U))
+                        {
+                            SERCOM3_REGS->I2CM.SERCOM_CTRLB |= SERCOM_I2CM_CTRLB_CMD(3UL);
 
-            /* Generate STOP condition */
-            SERCOM3_REGS->I2CM.SERCOM_CTRLB |= SERCOM_I2CM_CTRLB_CMD(3UL);
+                            /* Wait for synchronization */
+                            while((SERCOM3_REGS->I2CM.SERCOM_SYNCBUSY) != 0U)
+                            {
+                                /* Do nothing */
+                            }
+                        }
 
-            /* Wait for synchronization */
-            while((SERCOM3_REGS->I2CM.SERCOM_SYNCBUSY) != 0U)
-            {
-                /* Do nothing */
-            }
+                        sercom3I2CObj.state = SERCOM_I2C_STATE_TRANSFER_DONE;
+                    }
 
+                    break;
 
-            SERCOM3_REGS->I2CM.SERCOM_INTFLAG = (uint8_t)SERCOM_I2CM_INTFLAG_Msk;
+                case SERCOM_I2C_STATE_DMA_WRITE:
+                case SERCOM_I2C_STATE_DMA_READ:
 
-            if (sercom3I2CObj.callback != NULL)
-            {
-                sercom3I2CObj.callback(sercom3I2CObj.context);
-            }
-        }
-        /* Transfer Complete */
-        else if(sercom3I2CObj.state == SERCOM_I2C_STATE_TRANSFER_DONE)
-        {
-            /* Reset the PLib objects and interrupts */
-            sercom3I2CObj.state = SERCOM_I2C_STATE_IDLE;
-            sercom3I2CObj.error = SERCOM_I2C_ERROR_NONE;
-
-            SERCOM3_REGS->I2CM.SERCOM_INTFLAG = (uint8_t)SERCOM_I2CM_INTFLAG_Msk;
+                    /* Only the error interrupt is enabled while the DMAC moves the data */
+                    sercom3I2CObj.state = SERCOM_I2C_STATE_ERROR;
+                    sercom3I2CObj.error = SERCOM_I2C_ERROR_BUS;
+                    break;
 
-            /* Wait for the NAK and STOP bit to be transmitted out and I2C state machine to rest in IDLE state */
-            while((SERCOM3_REGS->I2CM.SERCOM_STATUS & SERCOM_I2CM_STATUS_BUSSTATE_Msk) != SERCOM_I2CM_STATUS_BUSSTATE(0x01U))
-            {
-                /* Do nothing */
-            }
+                default:
 
-            if(sercom3I2CObj.callback != NULL)
-            {
-                sercom3I2CObj.callback(sercom3I2CObj.context);
+                    /* Do nothing */
+                    break;
             }
-
-        }
-        else
-        {
-            /* Do nothing */
         }
+
+        SERCOM3_I2C_TransferFinish();
     }
 
     return;
-}
\ No newline at end of file
+}
+
+void SERCOM3_I2C_InterruptHandler(void)
+{
+    uint32_t start = DWT->CYCCNT;
+
+    sercom3I2CXferInterrupts++;
+
+    SERCOM3_I2C_TransferHandler();
+
+    sercom3I2CBenchmark.interrupts++;
+    sercom3I2CBenchmark.cycles += DWT->CYCCNT - start;
+}
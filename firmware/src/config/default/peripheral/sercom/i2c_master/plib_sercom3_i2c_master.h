@@ -92,6 +92,24 @@ bool SERCOM3_I2C_TransferSetup(SERCOM_I2C_TRANSFER_SETUP* setup, uint32_t srcClk
 
 void SERCOM3_I2C_TransferAbort( void );
 
+bool SERCOM3_I2C_BusRecover( void );
+
+bool SERCOM3_I2C_DMA_Read(uint16_t address, uint8_t* rdData, uint32_t rdLength);
+
+bool SERCOM3_I2C_DMA_Write(uint16_t address, uint8_t* wrData, uint32_t wrLength);
+
+bool SERCOM3_I2C_DMA_WriteRead(uint16_t address, uint8_t* wrData, uint32_t wrLength, uint8_t* rdData, uint32_t rdLength);
+
+bool SERCOM3_I2C_WriteVector(uint16_t address, const SERCOM_I2C_SEGMENT* segments, uint32_t segmentCount);
+
+bool SERCOM3_I2C_DMA_WriteVector(uint16_t address, const SERCOM_I2C_SEGMENT* segments, uint32_t segmentCount);
+
+bool SERCOM3_I2C_SMART_WriteRead(uint16_t address, uint8_t* wrData, uint32_t wrLength, uint8_t* rdData, uint32_t rdLength);
+
+void SERCOM3_I2C_BenchmarkGet(SERCOM_I2C_BENCHMARK* benchmark);
+
+void SERCOM3_I2C_BenchmarkReset(void);
+
 
 // DOM-IGNORE-BEGIN
 #ifdef __cplusplus  // Provide C++ Compatibility
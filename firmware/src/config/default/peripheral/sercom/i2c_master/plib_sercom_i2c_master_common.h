@@ -117,6 +117,9 @@ typedef enum
     /* A bus error has occurred. */
     SERCOM_I2C_ERROR_BUS,
 
+    /* Another master won the bus arbitration. */
+    SERCOM_I2C_ERROR_ARBITRATION_LOST,
+
 } SERCOM_I2C_ERROR;
 
 // *****************************************************************************
@@ -156,6 +159,15 @@ typedef enum
     /* SERCOM PLib Task Transfer Done State */
     SERCOM_I2C_STATE_TRANSFER_DONE,
 
+    /* SERCOM PLib Task DMA Write State, DMAC feeds the data bytes */
+    SERCOM_I2C_STATE_DMA_WRITE,
+
+    /* SERCOM PLib Task DMA Write Last Byte State, waiting for the final MB */
+    SERCOM_I2C_STATE_DMA_WRITE_LAST,
+
+    /* SERCOM PLib Task DMA Read State, DMAC drains the data bytes */
+    SERCOM_I2C_STATE_DMA_READ,
+
 } SERCOM_I2C_STATE;
 
 // *****************************************************************************
@@ -178,6 +190,29 @@ typedef void (*SERCOM_I2C_CALLBACK)
 
 );
 
+// *****************************************************************************
+/* SERCOM I2C Write Segment
+
+   Summary:
+    One buffer of a vectored write.
+
+   Description:
+    The segments of a vectored write are sent back to back as the data
+    bytes of a single bus transaction.
+
+   Remarks:
+    The segment array and the buffers must stay valid until the transfer
+    has completed.
+*/
+
+typedef struct
+{
+    uint8_t*                    buffer;
+
+    uint32_t                    length;
+
+} SERCOM_I2C_SEGMENT;
+
 // *****************************************************************************
 /* SERCOM I2C PLib Instance Object
 
@@ -215,6 +250,11 @@ typedef struct
 
     size_t                      readCount;
 
+    /* Segments of a vectored write still to be sent after writeBuffer */
+    const SERCOM_I2C_SEGMENT*   writeSegments;
+
+    uint32_t                    writeSegmentCount;
+
     /* State */
     volatile SERCOM_I2C_STATE   state;
 
@@ -249,6 +289,38 @@ typedef struct
 
 } SERCOM_I2C_TRANSFER_SETUP;
 
+// *****************************************************************************
+/* SERCOM I2C Benchmark Counters
+
+   Summary:
+    CPU cost of the transfers issued through the PLib.
+
+   Description:
+    interrupts counts every SERCOM interrupt and every DMAC channel callback
+    taken on behalf of the PLib, cycles accumulates the DWT cycle counter over
+    those handlers (including the client callback) and transfers counts the
+    completed or failed transfers. lastTransferInterrupts and
+    maxTransferInterrupts are the interrupts taken by the last transfer and
+    the most taken by any transfer since the last reset.
+
+   Remarks:
+    The DMAC dispatch before the channel callback is not included.
+*/
+
+typedef struct
+{
+    uint32_t interrupts;
+
+    uint32_t cycles;
+
+    uint32_t transfers;
+
+    uint32_t lastTransferInterrupts;
+
+    uint32_t maxTransferInterrupts;
+
+} SERCOM_I2C_BENCHMARK;
+
 // DOM-IGNORE-BEGIN
 #ifdef __cplusplus  // Provide C++ Compatibility
 
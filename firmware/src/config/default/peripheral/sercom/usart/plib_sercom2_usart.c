@@ -48,8 +48,10 @@
 // *****************************************************************************
 // *****************************************************************************
 
+#include <string.h>
 #include "interrupts.h"
 #include "plib_sercom2_usart.h"
+#include "peripheral/nvic/plib_nvic.h"
 
 // *****************************************************************************
 // *****************************************************************************
@@ -61,6 +63,20 @@
 /* SERCOM2 USART baud value for 115200 Hz baud rate */
 #define SERCOM2_USART_INT_BAUD_VALUE            (63522UL)
 
+/* Transmit ring drained by the DRE interrupt, one slot is always kept free */
+#define SERCOM2_USART_WRITE_BUFFER_SIZE         1024U
+
+/* What SERCOM2_USART_WriteBuffered does when the ring is full */
+#define SERCOM2_USART_WRITE_FULL_POLICY         USART_WRITE_FULL_DROP_NEWEST
+
+static uint8_t SERCOM2_USART_WriteBuffer[SERCOM2_USART_WRITE_BUFFER_SIZE];
+
+static SERCOM_USART_RING_BUFFER_OBJECT sercom2USARTObj;
+
+static USART_WRITE_FULL_POLICY sercom2USARTWriteFullPolicy = SERCOM2_USART_WRITE_FULL_POLICY;
+
+static USART_WRITE_STATISTICS sercom2USARTWriteStatistics;
+
 
 // *****************************************************************************
 // *****************************************************************************
@@ -122,6 +138,13 @@ void SERCOM2_USART_Initialize( void )
     }
 
 
+    /* Transmit ring starts empty, DRE interrupt is only enabled while it holds data */
+    sercom2USARTObj.wrCallback = NULL;
+    sercom2USARTObj.wrInIndex = 0U;
+    sercom2USARTObj.wrOutIndex = 0U;
+    sercom2USARTObj.wrBufferSize = SERCOM2_USART_WRITE_BUFFER_SIZE;
+    sercom2USARTObj.isWrNotificationEnabled = false;
+
     /* Enable the UART after the configurations */
     SERCOM2_REGS->USART_INT.SERCOM_CTRLA |= SERCOM_USART_INT_CTRLA_ENABLE_Msk;
 
@@ -313,6 +336,222 @@ void SERCOM2_USART_WriteByte( int data )
     SERCOM2_REGS->USART_INT.SERCOM_DATA = (uint16_t)data;
 }
 
+static size_t SERCOM2_USART_WriteCountLocked( void )
+{
+    uint32_t wrInIndex = sercom2USARTObj.wrInIndex;
+    uint32_t wrOutIndex = sercom2USARTObj.wrOutIndex;
+
+    if(wrInIndex >= wrOutIndex)
+    {
+        return wrInIndex - wrOutIndex;
+    }
+
+    return (sercom2USARTObj.wrBufferSize - wrOutIndex) + wrInIndex;
+}
+
+/* Moves one byte from the ring to the transmitter, caller checked DRE */
+static bool SERCOM2_USART_WriteNextByte( void )
+{
+    if(sercom2USARTObj.wrOutIndex == sercom2USARTObj.wrInIndex)
+    {
+        return false;
+    }
+
+    SERCOM2_REGS->USART_INT.SERCOM_DATA = SERCOM2_USART_WriteBuffer[sercom2USARTObj.wrOutIndex];
+
+    if(++sercom2USARTObj.wrOutIndex >= sercom2USARTObj.wrBufferSize)
+    {
+        sercom2USARTObj.wrOutIndex = 0U;
+    }
+
+    return true;
+}
+
+size_t SERCOM2_USART_WriteBuffered( const void *buffer, const size_t size )
+{
+    const uint8_t *pu8Data = (const uint8_t*)buffer;
+    size_t freeCount;
+    size_t queued = 0U;
+    size_t skip;
+    size_t chunk;
+    bool interruptState;
+
+    if((buffer == NULL) || (size == 0U))
+    {
+        return 0U;
+    }
+
+    interruptState = NVIC_INT_Disable();
+
+    freeCount = (sercom2USARTObj.wrBufferSize - 1U) - SERCOM2_USART_WriteCountLocked();
+
+    if(size > freeCount)
+    {
+        sercom2USARTWriteStatistics.fullWrites++;
+
+        if(sercom2USARTWriteFullPolicy == USART_WRITE_FULL_DROP_OLDEST)
+        {
+            /* Only the tail of a write larger than the whole ring can be kept */
+            skip = 0U;
+            if(size > (sercom2USARTObj.wrBufferSize - 1U))
+            {
+                skip = size - (sercom2USARTObj.wrBufferSize - 1U);
+                sercom2USARTWriteStatistics.overwrittenBytes += skip;
+                pu8Data = &pu8Data[skip];
+            }
+
+            /* Advance the read side over the oldest unsent bytes */
+            while(freeCount < (size - skip))
+            {
+                if(++sercom2USARTObj.wrOutIndex >= sercom2USARTObj.wrBufferSize)
+                {
+                    sercom2USARTObj.wrOutIndex = 0U;
+                }
+                sercom2USARTWriteStatistics.overwrittenBytes++;
+                freeCount++;
+            }
+
+            queued = skip;
+        }
+        else if(sercom2USARTWriteFullPolicy == USART_WRITE_FULL_DROP_NEWEST)
+        {
+            sercom2USARTWriteStatistics.droppedBytes += size - freeCount;
+
+            /* The refused bytes count as written, the caller has nothing to retry */
+            queued = size - freeCount;
+        }
+        else
+        {
+            /* USART_WRITE_FULL_BLOCK, the caller writes the rest once the ring drains */
+        }
+    }
+
+    /* Copied up to the end of the ring, then from its start */
+    while((freeCount != 0U) && (queued < size))
+    {
+        chunk = sercom2USARTObj.wrBufferSize - sercom2USARTObj.wrInIndex;
+
+        if(chunk > freeCount)
+        {
+            chunk = freeCount;
+        }
+        if(chunk > (size - queued))
+        {
+            chunk = size - queued;
+        }
+
+        (void)memcpy(&SERCOM2_USART_WriteBuffer[sercom2USARTObj.wrInIndex], pu8Data, chunk);
+        pu8Data = &pu8Data[chunk];
+
+        sercom2USARTObj.wrInIndex += chunk;
+        if(sercom2USARTObj.wrInIndex >= sercom2USARTObj.wrBufferSize)
+        {
+            sercom2USARTObj.wrInIndex = 0U;
+        }
+
+        sercom2USARTWriteStatistics.queuedBytes += chunk;
+        freeCount -= chunk;
+        queued += chunk;
+    }
+
+    if(SERCOM2_USART_WriteCountLocked() > sercom2USARTWriteStatistics.highWater)
+    {
+        sercom2USARTWriteStatistics.highWater = SERCOM2_USART_WriteCountLocked();
+    }
+
+    if(sercom2USARTObj.wrInIndex != sercom2USARTObj.wrOutIndex)
+    {
+        SERCOM2_REGS->USART_INT.SERCOM_INTENSET = (uint8_t)SERCOM_USART_INT_INTENSET_DRE_Msk;
+    }
+
+    NVIC_INT_Restore(interruptState);
+
+    return queued;
+}
+
+size_t SERCOM2_USART_WriteCountGet( void )
+{
+    size_t count;
+    bool interruptState = NVIC_INT_Disable();
+
+    count = SERCOM2_USART_WriteCountLocked();
+
+    NVIC_INT_Restore(interruptState);
+
+    return count;
+}
+
+size_t SERCOM2_USART_WriteFreeBufferCountGet( void )
+{
+    return (sercom2USARTObj.wrBufferSize - 1U) - SERCOM2_USART_WriteCountGet();
+}
+
+size_t SERCOM2_USART_WriteBufferSizeGet( void )
+{
+    return (sercom2USARTObj.wrBufferSize - 1U);
+}
+
+void SERCOM2_USART_WriteFlush( void )
+{
+    bool interruptState;
+    bool pending = true;
+
+    /* Drains the ring by polling, for callers the DRE interrupt cannot reach */
+    while(pending)
+    {
+        while((SERCOM2_REGS->USART_INT.SERCOM_INTFLAG & (uint8_t)SERCOM_USART_INT_INTFLAG_DRE_Msk) == 0U)
+        {
+            /* Do nothing */
+        }
+
+        interruptState = NVIC_INT_Disable();
+
+        if((SERCOM2_REGS->USART_INT.SERCOM_INTFLAG & (uint8_t)SERCOM_USART_INT_INTFLAG_DRE_Msk) != 0U)
+        {
+            pending = SERCOM2_USART_WriteNextByte();
+        }
+
+        NVIC_INT_Restore(interruptState);
+    }
+}
+
+void SERCOM2_USART_WriteFullPolicySet( USART_WRITE_FULL_POLICY policy )
+{
+    sercom2USARTWriteFullPolicy = policy;
+}
+
+USART_WRITE_FULL_POLICY SERCOM2_USART_WriteFullPolicyGet( void )
+{
+    return sercom2USARTWriteFullPolicy;
+}
+
+void SERCOM2_USART_WriteStatisticsGet( USART_WRITE_STATISTICS *statistics )
+{
+    bool interruptState;
+
+    if(statistics != NULL)
+    {
+        interruptState = NVIC_INT_Disable();
+
+        *statistics = sercom2USARTWriteStatistics;
+
+        NVIC_INT_Restore(interruptState);
+    }
+}
+
+void SERCOM2_USART_WriteStatisticsReset( void )
+{
+    bool interruptState = NVIC_INT_Disable();
+
+    sercom2USARTWriteStatistics.queuedBytes = 0U;
+    sercom2USARTWriteStatistics.droppedBytes = 0U;
+    sercom2USARTWriteStatistics.overwrittenBytes = 0U;
+    sercom2USARTWriteStatistics.fullWrites = 0U;
+    sercom2USARTWriteStatistics.highWater = SERCOM2_USART_WriteCountLocked();
+
+    NVIC_INT_Restore(interruptState);
+}
+
 bool SERCOM2_USART_TransmitComplete( void )
 {
     bool transmitComplete = false;
@@ -417,3 +656,15 @@ int SERCOM2_USART_ReadByte( void )
     return (int)SERCOM2_REGS->USART_INT.SERCOM_DATA;
 }
 
+void SERCOM2_USART_InterruptHandler( void )
+{
+    if(((SERCOM2_REGS->USART_INT.SERCOM_INTENSET & (uint8_t)SERCOM_USART_INT_INTENSET_DRE_Msk) != 0U) &&
+       ((SERCOM2_REGS->USART_INT.SERCOM_INTFLAG & (uint8_t)SERCOM_USART_INT_INTFLAG_DRE_Msk) != 0U))
+    {
+        if(SERCOM2_USART_WriteNextByte() == false)
+        {
+            /* Ring drained, DRE stays set so the interrupt has to go */
+            SERCOM2_REGS->USART_INT.SERCOM_INTENCLR = (uint8_t)SERCOM_USART_INT_INTENCLR_DRE_Msk;
+        }
+    }
+}
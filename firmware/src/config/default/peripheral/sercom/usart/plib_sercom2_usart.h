@@ -84,6 +84,26 @@ bool SERCOM2_USART_TransmitterIsReady( void );
 
 void SERCOM2_USART_WriteByte( int data );
 
+size_t SERCOM2_USART_WriteBuffered( const void *buffer, const size_t size );
+
+size_t SERCOM2_USART_WriteCountGet( void );
+
+size_t SERCOM2_USART_WriteFreeBufferCountGet( void );
+
+size_t SERCOM2_USART_WriteBufferSizeGet( void );
+
+void SERCOM2_USART_WriteFlush( void );
+
+void SERCOM2_USART_WriteFullPolicySet( USART_WRITE_FULL_POLICY policy );
+
+USART_WRITE_FULL_POLICY SERCOM2_USART_WriteFullPolicyGet( void );
+
+void SERCOM2_USART_WriteStatisticsGet( USART_WRITE_STATISTICS *statistics );
+
+void SERCOM2_USART_WriteStatisticsReset( void );
+
+void SERCOM2_USART_InterruptHandler( void );
+
 
 void SERCOM2_USART_ReceiverEnable( void );
 
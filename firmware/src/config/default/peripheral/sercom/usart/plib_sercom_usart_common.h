@@ -396,6 +396,63 @@ typedef struct
 
 } SERCOM_USART_RING_BUFFER_OBJECT;
 
+// *****************************************************************************
+/* USART Write Full Policy
+
+  Summary:
+    Defines what a buffered write does when the transmit ring is full.
+
+  Description:
+    USART_WRITE_FULL_BLOCK accepts what fits and leaves the rest to the
+    caller, which waits for the ring to drain and writes again.
+    USART_WRITE_FULL_DROP_OLDEST discards the oldest unsent bytes to make
+    room, USART_WRITE_FULL_DROP_NEWEST discards what does not fit.
+
+  Remarks:
+    None.
+*/
+
+typedef enum
+{
+    USART_WRITE_FULL_BLOCK = 0,
+
+    USART_WRITE_FULL_DROP_OLDEST,
+
+    USART_WRITE_FULL_DROP_NEWEST
+
+} USART_WRITE_FULL_POLICY;
+
+// *****************************************************************************
+/* USART Write Statistics
+
+  Summary:
+    Counters of the buffered transmit path.
+
+  Description:
+    queuedBytes counts the bytes accepted into the ring, droppedBytes the
+    bytes refused under USART_WRITE_FULL_DROP_NEWEST and overwrittenBytes the
+    unsent bytes discarded under USART_WRITE_FULL_DROP_OLDEST. fullWrites
+    counts the writes that found the ring full and highWater is the largest
+    number of bytes waiting in the ring.
+
+  Remarks:
+    None.
+*/
+
+typedef struct
+{
+    uint32_t queuedBytes;
+
+    uint32_t droppedBytes;
+
+    uint32_t overwrittenBytes;
+
+    uint32_t fullWrites;
+
+    uint32_t highWater;
+
+} USART_WRITE_STATISTICS;
+
 
 // DOM-IGNORE-BEGIN
 #ifdef __cplusplus  // Provide C++ Compatibility
@@ -62,13 +62,25 @@ int read(int handle, void *buffer, unsigned int len)
 
 int write(int handle, void * buffer, size_t count)
 {
-   bool success = false;
+   uint8_t *pu8Data = (uint8_t*)buffer;
+   size_t written = 0;
    if (handle == 1)
    {
-       do
+       /* Queued for the DRE interrupt, only the BLOCK policy waits for room */
+       written = SERCOM2_USART_WriteBuffered(pu8Data, count);
+       while (written < count)
        {
-           success = SERCOM2_USART_Write(buffer, count);
-       }while( !success);
+           if ((__get_IPSR() == 0U) && (__get_PRIMASK() == 0U) && (__get_BASEPRI() == 0U) && (xTaskGetSchedulerState() == taskSCHEDULER_RUNNING))
+           {
+               vTaskDelay(1);
+           }
+           else
+           {
+               /* Nothing drains the ring from here, empty it by polling */
+               SERCOM2_USART_WriteFlush();
+           }
+           written += SERCOM2_USART_WriteBuffered(&pu8Data[written], count - written);
+       }
    }
    return count;
 }
\ No newline at end of file
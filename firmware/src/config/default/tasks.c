@@ -59,6 +59,16 @@
 // Section: RTOS "Tasks" Routine
 // *****************************************************************************
 // *****************************************************************************
+void _DRV_I2C_0_Tasks(  void *pvParameters  )
+{
+    while(1)
+    {
+        DRV_I2C_Tasks(sysObj.drvI2C0);
+        /* Blocks while the bus is idle, a transfer start gives the notification */
+        (void)ulTaskNotifyTake(pdTRUE, DRV_I2C_TasksWaitTicks(sysObj.drvI2C0));
+    }
+}
+
 /* Handle for the APP_Tasks. */
 TaskHandle_t xAPP_Tasks;
 
@@ -66,8 +76,8 @@ void _APP_Tasks(  void *pvParameters  )
 {   
     while(1)
     {
+        /* Blocks on its task notification, see APP_EVENT_xxx */
         APP_Tasks();
-        vTaskDelay(10 / portTICK_PERIOD_MS);
     }
 }
 
@@ -93,7 +103,14 @@ void SYS_Tasks ( void )
     
 
     /* Maintain Device Drivers */
-    
+    xTaskCreate( _DRV_I2C_0_Tasks,
+        "DRV_I2C_0_TASKS",
+        DRV_I2C_RTOS_STACK_SIZE_IDX0,
+        (void*)NULL,
+        DRV_I2C_RTOS_TASK_PRIORITY_IDX0,
+        (TaskHandle_t*)NULL
+    );
+
 
     /* Maintain Middleware & Other Libraries */
     
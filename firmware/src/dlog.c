@@ -0,0 +1,204 @@
+/* ************************************************************************** */
+/** dlog.c
+
+  @Company
+    Microchip, Inc
+
+  @File Name
+    dlog.c
+
+  @Summary
+  Deferred logging records and the COBS framing shared with the telemetry
+
+  @Description
+  See dlog.h
+ */
+/* ************************************************************************** */
+
+#include <string.h>
+#include "definitions.h"
+#include "dlog.h"
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+/* Section: File Scope or Global Data                                         */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+/* COBS output of a frame: payload and CRC, one code byte per 254 and the two
+   delimiters. Encoded on the caller's stack, outside the interrupt lock */
+#define DLOG_FRAME_SIZE     (DLOG_FRAME_MAX + 2 + 2 + 2)
+
+static DLOG_STATISTICS dlogStatistics;
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+// Section: Local Functions                                                   */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+static uint16_t _DLOG_Crc16(uint16_t crc, const uint8_t* data, uint32_t length) {
+    uint32_t i;
+    uint8_t bit;
+
+    // CRC-16/CCITT-FALSE: polynomial 0x1021, initial 0xFFFF
+    for(i = 0; i < length; i++) {
+        crc ^= (uint16_t)data[i] << 8;
+        for(bit = 0; bit < 8; bit++) {
+            crc = (crc & 0x8000) ? (uint16_t)((crc << 1) ^ 0x1021) : (uint16_t)(crc << 1);
+        }
+    }
+    return crc;
+}
+
+static void _DLOG_CobsPut(uint8_t* frame, uint32_t* write, uint32_t* code, uint8_t byte) {
+    // Every 0x00 becomes the distance to the next one, frames stay under 254 bytes
+    if(byte == 0) {
+        frame[*code] = (uint8_t)(*write - *code);
+        *code = (*write)++;
+    } else {
+        frame[(*write)++] = byte;
+    }
+}
+
+static bool _DLOG_Room(DLOG_RECORD* record, uint32_t length) {
+    // Once an argument is dropped the ones after it would be read in its place
+    if(record->truncated || ((record->length + length) > DLOG_RECORD_SIZE)) {
+        record->truncated = true;
+        return false;
+    }
+    return true;
+}
+
+static void _DLOG_Put(DLOG_RECORD* record, const uint8_t* data, uint32_t length) {
+    if(_DLOG_Room(record, length)) {
+        memcpy(&record->payload[record->length], data, length);
+        record->length += length;
+    }
+}
+
+static void _DLOG_PutVarint(DLOG_RECORD* record, uint64_t value) {
+    uint8_t bytes[10];
+    uint32_t n = 0;
+
+    while(value >= 0x80) {
+        bytes[n++] = (uint8_t)(value | 0x80);
+        value >>= 7;
+    }
+    bytes[n++] = (uint8_t)value;
+    _DLOG_Put(record, bytes, n);
+}
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+// Section: Interface Functions                                               */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+void DLOG_Begin(DLOG_RECORD* record, const char* id) {
+    uint16_t offset = (uint16_t)(uintptr_t)id;
+
+    record->payload[0] = DLOG_FRAME_LOG;
+    record->payload[1] = (uint8_t)offset;
+    record->payload[2] = (uint8_t)(offset >> 8);
+    record->length = 3;
+    record->truncated = false;
+    // Tick of the call, the host shows it in front of the message
+    _DLOG_PutVarint(record, (__get_IPSR() != 0U) ? xTaskGetTickCountFromISR() : xTaskGetTickCount());
+}
+
+void DLOG_ArgU32(DLOG_RECORD* record, uint32_t value) {
+    _DLOG_PutVarint(record, value);
+}
+
+void DLOG_ArgU64(DLOG_RECORD* record, uint64_t value) {
+    _DLOG_PutVarint(record, value);
+}
+
+void DLOG_ArgDouble(DLOG_RECORD* record, double value) {
+    _DLOG_Put(record, (const uint8_t*)&value, sizeof(value));
+}
+
+void DLOG_ArgString(DLOG_RECORD* record, const char* value) {
+    uint8_t length = 0;
+
+    if(value != NULL) {
+        while((length < DLOG_STRING_MAX) && (value[length] != '\0')) {
+            length++;
+        }
+    }
+    if(_DLOG_Room(record, 1 + length)) {
+        record->payload[record->length++] = length;
+        _DLOG_Put(record, (const uint8_t*)value, length);
+    }
+}
+
+void DLOG_ArgPointer(DLOG_RECORD* record, const void* value) {
+    _DLOG_PutVarint(record, (uint32_t)(uintptr_t)value);
+}
+
+void DLOG_End(DLOG_RECORD* record) {
+    if(record->truncated) {
+        record->payload[0] = DLOG_FRAME_LOG_TRUNCATED;
+    }
+    if(DLOG_FrameWrite(record->payload, record->length) != 0) {
+        dlogStatistics.records++;
+        if(record->truncated) {
+            dlogStatistics.truncated++;
+        }
+    }
+}
+
+uint32_t DLOG_FrameWrite(const uint8_t* payload, uint32_t length) {
+    uint8_t frame[DLOG_FRAME_SIZE];
+    uint16_t crc;
+    uint32_t i, write, code;
+    bool interruptState;
+
+    if((payload == NULL) || (length == 0) || (length > DLOG_FRAME_MAX)) {
+        return 0;
+    }
+    // CRC and COBS only touch the caller's payload and stack, keep them out of the lock
+    crc = _DLOG_Crc16(0xFFFF, payload, length);
+
+    // Delimiters on both sides keep printf text out of the frame
+    frame[0] = 0;
+    code = 1;
+    write = 2;
+    for(i = 0; i < length; i++) {
+        _DLOG_CobsPut(frame, &write, &code, payload[i]);
+    }
+    _DLOG_CobsPut(frame, &write, &code, (uint8_t)crc);
+    _DLOG_CobsPut(frame, &write, &code, (uint8_t)(crc >> 8));
+    frame[code] = (uint8_t)(write - code);
+    frame[write++] = 0;
+
+    // Whole frame or nothing, a partial one would only fail the CRC on the host.
+    // The lock keeps the space check and the ring copy together
+    interruptState = NVIC_INT_Disable();
+    if(SERCOM2_USART_WriteFreeBufferCountGet() >= write) {
+        SERCOM2_USART_WriteBuffered(frame, write);
+        dlogStatistics.frames++;
+        dlogStatistics.bytes += write;
+    } else {
+        dlogStatistics.dropped++;
+        write = 0;
+    }
+    NVIC_INT_Restore(interruptState);
+
+    return write;
+}
+
+void DLOG_StatisticsGet(DLOG_STATISTICS* statistics) {
+    bool interruptState;
+
+    if(statistics != NULL) {
+        interruptState = NVIC_INT_Disable();
+        *statistics = dlogStatistics;
+        NVIC_INT_Restore(interruptState);
+    }
+}
+
+/* *****************************************************************************
+ End of File
+ */
@@ -0,0 +1,255 @@
+/* ************************************************************************** */
+/** dlog.h
+
+  @Company
+    Microchip, Inc
+
+  @File Name
+    dlog.h
+
+  @Summary
+  Deferred logging: call sites send a format ID and the raw arguments, the
+  host formats them with tools/dlog_decode.py and the built ELF
+
+  @Description
+  Every DLOG_xxx call site places its format string, prefixed with the level,
+  file and line, in the .dlog_fmt section. The linker script keeps that section
+  out of flash (INFO), so the string costs nothing on target and its address
+  in the section is the ID sent. Arguments are sent as LEB128 integers, raw
+  doubles or short length prefixed strings, chosen from their C type.
+
+  Levels above DLOG_LEVEL compile to nothing, arguments are not evaluated.
+  With DLOG_DEFERRED 0 the macros fall back to printf.
+
+  Records share the UART with the sample telemetry: COBS encoded between two
+  0x00 delimiters, payload type DLOG_FRAME_LOG, see DLOG_FrameWrite.
+ */
+/* ************************************************************************** */
+
+#ifndef DLOG_H    /* Guard against multiple inclusion */
+#define DLOG_H
+
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+/* Section: Included Files                                                    */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include "configuration.h"
+
+/* Provide C++ Compatibility */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+/* Section: Constants                                                         */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+/* Levels, same order as SYS_ERROR_LEVEL, usable in #if */
+#define DLOG_LEVEL_NONE     (-1)
+#define DLOG_LEVEL_FATAL    0
+#define DLOG_LEVEL_ERROR    1
+#define DLOG_LEVEL_WARNING  2
+#define DLOG_LEVEL_INFO     3
+#define DLOG_LEVEL_DEBUG    4
+
+#ifndef DLOG_LEVEL
+#define DLOG_LEVEL          DLOG_LEVEL_INFO
+#endif
+
+#ifndef DLOG_DEFERRED
+#define DLOG_DEFERRED       1
+#endif
+
+/* Payload bytes of one record: type, ID, tick and the arguments. Arguments
+   that do not fit are dropped and the record flagged truncated */
+#ifndef DLOG_RECORD_SIZE
+#define DLOG_RECORD_SIZE    64
+#endif
+
+/* Longest string argument copied into a record */
+#define DLOG_STRING_MAX     24
+
+/* Frame type bytes, first byte of a frame payload */
+#define DLOG_FRAME_LOG            0x02
+#define DLOG_FRAME_LOG_TRUNCATED  0x03
+
+/* Largest frame DLOG_FrameWrite sends, payload before CRC and COBS */
+#define DLOG_FRAME_MAX      250
+
+/* Format string fields, split by the host on the unit separator */
+#define DLOG_SEPARATOR      "\x1f"
+
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+/* Section: Data Types                                                        */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+/**
+ * @brief Record under construction, on the caller's stack
+ */
+typedef struct {
+    uint8_t payload[DLOG_RECORD_SIZE];
+    uint32_t length;
+    bool truncated;
+} DLOG_RECORD;
+
+/**
+ * @brief Log and frame counters since start
+ */
+typedef struct {
+    uint32_t records;                   // Log records sent
+    uint32_t frames;                    // Frames sent, records and telemetry
+    uint32_t bytes;                     // Encoded bytes sent, delimiters included
+    uint32_t dropped;                   // Frames that did not fit in the UART ring
+    uint32_t truncated;                 // Records that lost arguments
+} DLOG_STATISTICS;
+
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+/* Section: Interface Functions                                               */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+/**
+ * @brief Start a record for the format string at id
+ *
+ * @param record - Record to fill
+ * @param id - Format string, its .dlog_fmt address is the ID sent
+ */
+void DLOG_Begin(DLOG_RECORD* record, const char* id);
+
+/**
+ * @brief Append one argument, called through DLOG_ARG
+ */
+void DLOG_ArgU32(DLOG_RECORD* record, uint32_t value);
+void DLOG_ArgU64(DLOG_RECORD* record, uint64_t value);
+void DLOG_ArgDouble(DLOG_RECORD* record, double value);
+void DLOG_ArgString(DLOG_RECORD* record, const char* value);
+void DLOG_ArgPointer(DLOG_RECORD* record, const void* value);
+
+/**
+ * @brief Send the record, whole or not at all
+ */
+void DLOG_End(DLOG_RECORD* record);
+
+/**
+ * @brief Send a frame payload on the console UART
+ *
+ * Appends a CRC-16/CCITT-FALSE, COBS encodes the payload and queues it
+ * between two 0x00 delimiters on the SERCOM2 transmit ring. A frame that does
+ * not fit in the ring is dropped whole and counted. Safe from interrupts.
+ *
+ * @param payload - Frame type byte followed by the frame contents
+ * @param length - Bytes in payload, at most DLOG_FRAME_MAX
+ * @return Encoded bytes queued, 0 if dropped
+ */
+uint32_t DLOG_FrameWrite(const uint8_t* payload, uint32_t length);
+
+/**
+ * @brief Copy the counters
+ *
+ * @param statistics - Destination
+ */
+void DLOG_StatisticsGet(DLOG_STATISTICS* statistics);
+
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+/* Section: Logging Macros                                                    */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+#define _DLOG_STR(x) #x
+#define _DLOG_XSTR(x) _DLOG_STR(x)
+
+/* Argument encoder picked from the argument's type, integers narrower than
+   64 bits are promoted like printf would */
+#define DLOG_ARG(record, x) _Generic((x),                                       \
+        char*: DLOG_ArgString,                                                  \
+        const char*: DLOG_ArgString,                                            \
+        void*: DLOG_ArgPointer,                                                 \
+        const void*: DLOG_ArgPointer,                                           \
+        long long: DLOG_ArgU64,                                                 \
+        unsigned long long: DLOG_ArgU64,                                        \
+        float: DLOG_ArgDouble,                                                  \
+        double: DLOG_ArgDouble,                                                 \
+        default: DLOG_ArgU32)((record), (x))
+
+#define _DLOG_NARGS(...) _DLOG_NARGS_(0, ##__VA_ARGS__, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0)
+#define _DLOG_NARGS_(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, N, ...) N
+
+#define _DLOG_ARGS_0(r)
+#define _DLOG_ARGS_1(r, a)      DLOG_ARG(r, a);
+#define _DLOG_ARGS_2(r, a, ...) DLOG_ARG(r, a); _DLOG_ARGS_1(r, __VA_ARGS__)
+#define _DLOG_ARGS_3(r, a, ...) DLOG_ARG(r, a); _DLOG_ARGS_2(r, __VA_ARGS__)
+#define _DLOG_ARGS_4(r, a, ...) DLOG_ARG(r, a); _DLOG_ARGS_3(r, __VA_ARGS__)
+#define _DLOG_ARGS_5(r, a, ...) DLOG_ARG(r, a); _DLOG_ARGS_4(r, __VA_ARGS__)
+#define _DLOG_ARGS_6(r, a, ...) DLOG_ARG(r, a); _DLOG_ARGS_5(r, __VA_ARGS__)
+#define _DLOG_ARGS_7(r, a, ...) DLOG_ARG(r, a); _DLOG_ARGS_6(r, __VA_ARGS__)
+#define _DLOG_ARGS_8(r, a, ...) DLOG_ARG(r, a); _DLOG_ARGS_7(r, __VA_ARGS__)
+#define _DLOG_ARGS_9(r, a, ...) DLOG_ARG(r, a); _DLOG_ARGS_8(r, __VA_ARGS__)
+#define _DLOG_ARGS_10(r, a, ...) DLOG_ARG(r, a); _DLOG_ARGS_9(r, __VA_ARGS__)
+#define _DLOG_ARGS_N(n) _DLOG_ARGS_##n
+#define _DLOG_ARGS_X(n) _DLOG_ARGS_N(n)
+#define _DLOG_ARGS(r, ...) _DLOG_ARGS_X(_DLOG_NARGS(__VA_ARGS__))(r, ##__VA_ARGS__)
+
+#if DLOG_DEFERRED == 1
+#define _DLOG(level, format, ...) do {                                          \
+        static const char _dlogFormat[] __attribute__((section(".dlog_fmt"), used)) = \
+            level DLOG_SEPARATOR __FILE__ DLOG_SEPARATOR _DLOG_XSTR(__LINE__) DLOG_SEPARATOR format; \
+        DLOG_RECORD _dlogRecord;                                                \
+        DLOG_Begin(&_dlogRecord, _dlogFormat);                                  \
+        _DLOG_ARGS(&_dlogRecord, ##__VA_ARGS__)                                 \
+        DLOG_End(&_dlogRecord);                                                 \
+    } while(0)
+#else
+#define _DLOG(level, format, ...) printf(format, ##__VA_ARGS__)
+#endif
+
+#if DLOG_LEVEL >= DLOG_LEVEL_ERROR
+#define DLOG_ERROR(format, ...)     _DLOG("E", format, ##__VA_ARGS__)
+#else
+#define DLOG_ERROR(format, ...)     do { } while(0)
+#endif
+
+#if DLOG_LEVEL >= DLOG_LEVEL_WARNING
+#define DLOG_WARNING(format, ...)   _DLOG("W", format, ##__VA_ARGS__)
+#else
+#define DLOG_WARNING(format, ...)   do { } while(0)
+#endif
+
+#if DLOG_LEVEL >= DLOG_LEVEL_INFO
+#define DLOG_INFO(format, ...)      _DLOG("I", format, ##__VA_ARGS__)
+#else
+#define DLOG_INFO(format, ...)      do { } while(0)
+#endif
+
+#if DLOG_LEVEL >= DLOG_LEVEL_DEBUG
+#define DLOG_DEBUG(format, ...)     _DLOG("D", format, ##__VA_ARGS__)
+#else
+#define DLOG_DEBUG(format, ...)     do { } while(0)
+#endif
+
+
+/* Provide C++ Compatibility */
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DLOG_H */
+
+/* *****************************************************************************
+ End of File
+ */
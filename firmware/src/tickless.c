@@ -0,0 +1,245 @@
+/* ************************************************************************** */
+/** tickless.c
+
+  @Company
+    Microchip, Inc
+
+  @File Name
+    tickless.c
+
+  @Summary
+  FreeRTOS tickless idle on the RTC
+
+  @Description
+  See tickless.h
+ */
+/* ************************************************************************** */
+
+#include "definitions.h"
+#include "tickless.h"
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+/* Section: File Scope or Global Data                                         */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+#define TICKLESS_CYCLES_PER_TICK (configCPU_CLOCK_HZ / configTICK_RATE_HZ)
+
+/* Shortest SysTick reload after a sleep, in CPU cycles */
+#define TICKLESS_MIN_RELOAD      256U
+
+static uint32_t ticklessCountHz = RTC_TIMER32_FREQUENCY;
+
+/* Integration period in RTC counts per CONFIG ATIME field, 0 for the reserved
+   codes. Rebuilt with ticklessCountHz so the idle entry stays integer only */
+static uint32_t ticklessPeriodCounts[TSL2591_CONFIG_ATIME_MASK + 1];
+static uint32_t ticklessStandbyMinCounts;
+
+static const DATA_TSL2591* ticklessSensor;
+static volatile uint32_t ticklessEventCount;     // RTC count of the last sensor interrupt
+static volatile bool ticklessEventValid;
+
+static TICKLESS_STATISTICS ticklessStatistics;
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+// Section: Local Functions                                                   */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+static uint32_t _TICKLESS_CyclesToCounts(uint64_t cycles) {
+    return (uint32_t)((cycles * ticklessCountHz) / configCPU_CLOCK_HZ);
+}
+
+static uint64_t _TICKLESS_CountsToCycles(uint32_t counts) {
+    return ((uint64_t)counts * configCPU_CLOCK_HZ) / ticklessCountHz;
+}
+
+static void _TICKLESS_PeriodsUpdate(void) {
+    uint32_t atime;
+
+    for(atime = 0; atime <= TSL2591_CONFIG_ATIME_MASK; atime++) {
+        ticklessPeriodCounts[atime] = (atime <= TSL2591_CONFIG_ATIME_600MS)
+                ? (((atime + 1U) * 100U * ticklessCountHz) + 500U) / 1000U : 0U;
+    }
+    ticklessStandbyMinCounts = (ticklessCountHz * TICKLESS_STANDBY_MIN_MS) / 1000U;
+}
+
+static bool _TICKLESS_StandbyAllowed(uint32_t now, uint32_t sleepCounts) {
+    uint32_t minCounts = ticklessStandbyMinCounts;
+    uint32_t period, phase;
+
+    if(sleepCounts < minCounts) {
+        return false;
+    }
+    // Their clocks stop in STANDBY, a byte or transfer in flight would be cut
+    if(SERCOM3_I2C_IsBusy() || (SERCOM2_USART_WriteCountGet() != 0) || !SERCOM2_USART_TransmitComplete()) {
+        return false;
+    }
+    if(ticklessSensor != NULL) {
+        // The chain needs the DMAC and SERCOM3 awake on every EXTINT7 event
+        if(ticklessSensor->asyncState != TSL2591_ASYNC_IDLE) {
+            return false;
+        }
+        // Integrations end every ATIME period from the last interrupt; one
+        // due soon should find the CPU in IDLE, not restarting its clocks
+        if(ticklessEventValid) {
+            period = ticklessPeriodCounts[ticklessSensor->config & TSL2591_CONFIG_ATIME_MASK];
+            if(period != 0) {
+                phase = (now - ticklessEventCount) % period;
+                if((period - phase) < minCounts) {
+                    return false;
+                }
+            }
+        }
+    }
+    return true;
+}
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+// Section: Interface Functions                                               */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+void TICKLESS_Initialize(void) {
+    uint32_t start, count, cycles;
+
+    RTC_Timer32Start();
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    // OSCULP32K is only good to a few percent, time it against the CPU clock
+    // from one count edge to another so the read latency cancels out
+    start = RTC_Timer32CounterGet();
+    do {
+        count = RTC_Timer32CounterGet();
+    } while(count == start);
+    cycles = DWT->CYCCNT;
+    while((RTC_Timer32CounterGet() - count) < TICKLESS_CALIBRATION_COUNTS) {
+    }
+    cycles = DWT->CYCCNT - cycles;
+    ticklessCountHz = (uint32_t)((((uint64_t)TICKLESS_CALIBRATION_COUNTS * configCPU_CLOCK_HZ) + (cycles / 2U)) / cycles);
+    ticklessStatistics.countHz = ticklessCountHz;
+    _TICKLESS_PeriodsUpdate();
+}
+
+void TICKLESS_SensorSet(const DATA_TSL2591* sensor) {
+    ticklessSensor = sensor;
+    ticklessEventValid = false;
+}
+
+void TICKLESS_SensorEvent(void) {
+    ticklessEventCount = RTC_Timer32CounterGet();
+    ticklessEventValid = true;
+    ticklessStatistics.sensorEvents++;
+}
+
+void TICKLESS_StatisticsGet(TICKLESS_STATISTICS* statistics) {
+    if(statistics != NULL) {
+        taskENTER_CRITICAL();
+        *statistics = ticklessStatistics;
+        taskEXIT_CRITICAL();
+        statistics->now = RTC_Timer32CounterGet();
+    }
+}
+
+/* Replaces the port's weak SysTick version, see configUSE_TICKLESS_IDLE */
+void vPortSuppressTicksAndSleep(TickType_t xExpectedIdleTime) {
+    uint32_t gone, left, start, end, sleepCounts, remainder;
+    uint64_t cycles;
+    TickType_t ticks;
+    bool standby;
+    uint8_t mode;
+
+    if(xExpectedIdleTime > TICKLESS_MAX_IDLE_TICKS) {
+        xExpectedIdleTime = TICKLESS_MAX_IDLE_TICKS;
+    }
+
+    // PRIMASK only: a pending interrupt still ends WFI, its handler runs once
+    // the kernel time is right again
+    __disable_irq();
+    __DSB();
+    __ISB();
+    if(eTaskConfirmSleepModeStatus() == eAbortSleep) {
+        __enable_irq();
+        return;
+    }
+
+    // Freeze the tick, keeping the part of the period already gone. A tick
+    // already pending is a whole period gone, taken here instead
+    SysTick->CTRL = SysTick_CTRL_CLKSOURCE_Msk | SysTick_CTRL_TICKINT_Msk;
+    left = SysTick->VAL;
+    if(left == 0) {
+        left = TICKLESS_CYCLES_PER_TICK;
+    }
+    gone = TICKLESS_CYCLES_PER_TICK - left;
+    if((SCB->ICSR & SCB_ICSR_PENDSTSET_Msk) != 0) {
+        SCB->ICSR = SCB_ICSR_PENDSTCLR_Msk;
+        gone += TICKLESS_CYCLES_PER_TICK;
+    }
+
+    start = RTC_Timer32CounterGet();
+    sleepCounts = _TICKLESS_CyclesToCounts(((uint64_t)xExpectedIdleTime * TICKLESS_CYCLES_PER_TICK) - gone);
+    standby = _TICKLESS_StandbyAllowed(start, sleepCounts);
+    mode = standby ? PM_SLEEPCFG_SLEEPMODE_STANDBY : PM_SLEEPCFG_SLEEPMODE_IDLE;
+
+    RTC_Timer32CompareSet(start + sleepCounts);
+    (void)RTC_Timer32CompareHasMatched();
+    RTC_Timer32InterruptEnable(RTC_TIMER32_INT_MASK_CMP0);
+    PM_REGS->PM_SLEEPCFG = mode;
+    while((PM_REGS->PM_SLEEPCFG & PM_SLEEPCFG_SLEEPMODE_Msk) != mode) {
+        /* Wait for the mode to take effect */
+    }
+
+    // COMP0 takes a few RTC clocks to synchronize, a match it missed would
+    // only come back after the counter wraps
+    if((sleepCounts > 1U) && ((RTC_Timer32CounterGet() - start) < (sleepCounts - 1U))) {
+        __DSB();
+        __WFI();
+        __ISB();
+    }
+
+    end = RTC_Timer32CounterGet();
+    RTC_Timer32InterruptDisable(RTC_TIMER32_INT_MASK_CMP0);
+    if(RTC_Timer32CompareHasMatched()) {
+        ticklessStatistics.timerWakeups++;
+    }
+    NVIC_ClearPendingIRQ(RTC_IRQn);
+    PM_REGS->PM_SLEEPCFG = PM_SLEEPCFG_SLEEPMODE_IDLE;
+
+    // Whole ticks slept are stepped, the rest of the period in progress is
+    // what SysTick counts down first. Up to one RTC count (~30 us) of kernel
+    // time is lost per sleep to the unsynchronized start read
+    cycles = gone + _TICKLESS_CountsToCycles(end - start);
+    ticks = (TickType_t)(cycles / TICKLESS_CYCLES_PER_TICK);
+    remainder = (uint32_t)(cycles % TICKLESS_CYCLES_PER_TICK);
+    if((TICKLESS_CYCLES_PER_TICK - remainder) < TICKLESS_MIN_RELOAD) {
+        // Too close to the next tick to reload SysTick for, take it now
+        ticks++;
+        remainder = 0;
+    }
+    if(ticks >= xExpectedIdleTime) {
+        ticks = xExpectedIdleTime;
+        remainder = 0;
+    }
+    SysTick->LOAD = (TICKLESS_CYCLES_PER_TICK - remainder) - 1U;
+    SysTick->VAL = 0;
+    SysTick->CTRL = SysTick_CTRL_CLKSOURCE_Msk | SysTick_CTRL_TICKINT_Msk | SysTick_CTRL_ENABLE_Msk;
+    SysTick->LOAD = TICKLESS_CYCLES_PER_TICK - 1U;
+    vTaskStepTick(ticks);
+
+    ticklessStatistics.sleeps++;
+    if(standby) {
+        ticklessStatistics.standbySleeps++;
+    }
+    ticklessStatistics.sleptCounts += end - start;
+    ticklessStatistics.steppedTicks += ticks;
+
+    __enable_irq();
+}
+
+/* *****************************************************************************
+ End of File
+ */
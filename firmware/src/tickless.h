@@ -0,0 +1,132 @@
+/* ************************************************************************** */
+/** tickless.h
+
+  @Company
+    Microchip, Inc
+
+  @File Name
+    tickless.h
+
+  @Summary
+  FreeRTOS tickless idle on the RTC, with the sleep mode chosen around the
+  TSL2591 integration cycle
+
+  @Description
+  vPortSuppressTicksAndSleep is provided here instead of the port's SysTick
+  version: SysTick stops in STANDBY, the RTC (OSCULP32K, calibrated against the
+  CPU clock at start) does not. The RTC compare match ends the sleep when the
+  next task unblocks, EXTINT7 from the sensor ends it earlier.
+
+  The idle task picks STANDBY, the deepest mode that keeps RAM and still wakes
+  on EIC_PIN_7 (the EIC runs from ULP32K), when nothing is in flight on SERCOM2
+  or SERCOM3, the sensor instance is not mid-transfer or owned by the hardware
+  chain, and the next integration end, predicted from the last sensor
+  interrupt and the ATIME field of its CONFIG, is at least TICKLESS_STANDBY_MIN_MS away. Otherwise
+  it sleeps in IDLE. HIBERNATE and below lose RAM and cannot wake on EXTINT.
+ */
+/* ************************************************************************** */
+
+#ifndef TICKLESS_H    /* Guard against multiple inclusion */
+#define TICKLESS_H
+
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+/* Section: Included Files                                                    */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "DRV_TSL2591.h"
+
+/* Provide C++ Compatibility */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+/* Section: Constants                                                         */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+/* Shortest sleep, and closest predicted sensor interrupt, worth STANDBY: the
+   clock sources restart and the DPLL relocks on the way out */
+#define TICKLESS_STANDBY_MIN_MS     3
+
+/* Longest sleep, the kernel tick is stepped at least this often (ticks) */
+#define TICKLESS_MAX_IDLE_TICKS     60000U
+
+/* RTC counts timed against DWT->CYCCNT at start, ~10 ms */
+#define TICKLESS_CALIBRATION_COUNTS 328U
+
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+/* Section: Data Types                                                        */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+/**
+ * @brief Sleep counters since start, deltas of two reads give the rates
+ */
+typedef struct {
+    uint32_t now;                       // RTC count when read
+    uint32_t countHz;                   // Calibrated RTC frequency
+    uint32_t sleeps;                    // Sleeps entered, each ends in one wake-up
+    uint32_t standbySleeps;             // Of those, in STANDBY
+    uint32_t timerWakeups;              // Ended by the RTC, not by an interrupt
+    uint32_t sleptCounts;               // RTC counts spent asleep, wraps like now
+    uint32_t steppedTicks;              // Kernel ticks that were never taken
+    uint32_t sensorEvents;              // Sensor interrupts, the wake-up floor
+} TICKLESS_STATISTICS;
+
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+/* Section: Interface Functions                                               */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+/**
+ * @brief Start the RTC and calibrate it, before the scheduler starts
+ *
+ * Busy waits TICKLESS_CALIBRATION_COUNTS RTC counts.
+ */
+void TICKLESS_Initialize(void);
+
+/**
+ * @brief Sensor whose integration cycle paces the sleep mode choice
+ *
+ * @param sensor - Instance read for its ATIME and transfer state, NULL
+ *                 for none
+ */
+void TICKLESS_SensorSet(const DATA_TSL2591* sensor);
+
+/**
+ * @brief Note a sensor interrupt, from its EIC callback
+ *
+ * Sets the phase of the predicted integration ends.
+ */
+void TICKLESS_SensorEvent(void);
+
+/**
+ * @brief Copy the counters
+ *
+ * @param statistics - Destination
+ */
+void TICKLESS_StatisticsGet(TICKLESS_STATISTICS* statistics);
+
+
+/* Provide C++ Compatibility */
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TICKLESS_H */
+
+/* *****************************************************************************
+ End of File
+ */
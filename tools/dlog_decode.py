@@ -0,0 +1,166 @@
+#!/usr/bin/env python3
+"""Format the deferred log records (dlog.h) of a UART capture using the ELF.
+
+The target sends each DLOG_xxx call as a frame holding the offset of its
+format string in the ELF's non-loaded .dlog_fmt section, the RTOS tick and the
+raw arguments. This tool looks the strings up in the ELF the firmware was
+built from and formats them here. Sample telemetry frames in the same stream
+can be written to a CSV file, printf text is passed through.
+
+    dlog_decode.py dist/default/debug/Ambient21Click.X.debug.elf capture.bin
+    dlog_decode.py firmware.elf --samples samples.csv < /dev/ttyACM0
+"""
+
+import argparse
+import os
+import re
+import struct
+import sys
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+from telemetry_decode import (FrameError, LOG, LOG_TRUNCATED, SampleWriter,  # noqa: E402
+                              chunks, decode_samples, frame_payload, is_text)
+
+SECTION = ".dlog_fmt"
+SEPARATOR = "\x1f"
+LEVELS = {"E": "ERROR", "W": "WARN", "I": "INFO", "D": "DEBUG"}
+
+# printf conversion: flags, width, precision, length, conversion
+CONVERSION = re.compile(r"%([-+ #0]*)(\d+|\*)?(?:\.(\d+|\*))?(hh|h|ll|l|j|z|t|L)?([diouxXcspfFeEgGaA%])")
+
+
+def elf_section(path, name):
+    """Contents of a section of a 32-bit little endian ELF."""
+    with open(path, "rb") as elf:
+        data = elf.read()
+    if data[:4] != b"\x7fELF" or data[4] != 1 or data[5] != 1:
+        raise SystemExit("%s: not a 32-bit little endian ELF" % path)
+    shoff, = struct.unpack_from("<I", data, 0x20)
+    shentsize, shnum, shstrndx = struct.unpack_from("<HHH", data, 0x2E)
+
+    def header(index):
+        return struct.unpack_from("<IIIIIIIIII", data, shoff + index * shentsize)
+
+    names = header(shstrndx)
+    for index in range(shnum):
+        fields = header(index)
+        start = names[4] + fields[0]
+        section_name = data[start:data.index(b"\x00", start)].decode("ascii")
+        if section_name == name:
+            return data[fields[4]:fields[4] + fields[5]]
+    raise SystemExit("%s: no %s section, was it built with DLOG_DEFERRED 1?" % (path, name))
+
+
+def uvarint(body, pos):
+    value = 0
+    shift = 0
+    while True:
+        if pos >= len(body) or shift > 63:
+            raise FrameError("truncated argument")
+        byte = body[pos]
+        pos += 1
+        value |= (byte & 0x7F) << shift
+        shift += 7
+        if not byte & 0x80:
+            return value, pos
+
+
+class Formats:
+    """Format strings of the .dlog_fmt section by offset."""
+
+    def __init__(self, section):
+        self.section = section
+        self.cache = {}
+
+    def get(self, offset):
+        if offset not in self.cache:
+            if offset >= len(self.section):
+                raise FrameError("format ID 0x%04x outside %s, wrong ELF?" % (offset, SECTION))
+            end = self.section.index(b"\x00", offset)
+            fields = self.section[offset:end].decode("utf-8", "replace").split(SEPARATOR, 3)
+            if len(fields) != 4:
+                raise FrameError("format ID 0x%04x is not a record start, wrong ELF?" % offset)
+            level, path, line, fmt = fields
+            conversions = [m for m in CONVERSION.finditer(fmt) if m.group(5) != "%"]
+            # Python's % takes no length modifiers and no %p
+            pyfmt = CONVERSION.sub(lambda m: "%%%s%s%s%s" % (
+                m.group(1), m.group(2) or "", "." + m.group(3) if m.group(3) else "",
+                "#x" if m.group(5) == "p" else m.group(5)), fmt)
+            self.cache[offset] = (LEVELS.get(level, level), os.path.basename(path), line, pyfmt, conversions)
+        return self.cache[offset]
+
+
+def decode_log(body, formats):
+    offset = body[1] | (body[2] << 8)
+    level, path, line, pyfmt, conversions = formats.get(offset)
+    tick, pos = uvarint(body, 3)
+    args = []
+    for conversion in conversions:
+        length, kind = conversion.group(4), conversion.group(5)
+        if pos >= len(body):
+            break
+        if kind == "s":
+            size = body[pos]
+            if pos + 1 + size > len(body):
+                break
+            args.append(body[pos + 1:pos + 1 + size].decode("utf-8", "replace"))
+            pos += 1 + size
+        elif kind in "fFeEgGaA":
+            if pos + 8 > len(body):
+                break
+            args.append(struct.unpack_from("<d", body, pos)[0])
+            pos += 8
+        else:
+            value, pos = uvarint(body, pos)
+            bits = 64 if length in ("ll", "j") else 32
+            if kind in "di" and value & (1 << (bits - 1)):
+                value -= 1 << bits
+            args.append(chr(value & 0xFF) if kind == "c" else value)
+    truncated = body[0] == LOG_TRUNCATED or len(args) < len(conversions)
+    if truncated:
+        # Missing arguments print as '?', keep the placeholders' types happy
+        pyfmt = CONVERSION.sub(lambda m: m.group(0) if m.group(5) == "%" else "%s", pyfmt)
+        args = [str(a) for a in args] + ["?"] * (len(conversions) - len(args))
+    try:
+        message = pyfmt % tuple(args)
+    except (TypeError, ValueError) as error:
+        message = "%s %r (%s)" % (pyfmt, args, error)
+    return "%10d %-5s %s:%s %s%s" % (tick, level, path, line, message.rstrip("\r\n"),
+                                    " [truncated]" if truncated else "")
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("elf", help="ELF the running firmware was built from")
+    parser.add_argument("capture", nargs="?", help="raw UART capture, stdin if omitted")
+    parser.add_argument("--samples", metavar="CSV", help="write the sample telemetry frames to this file")
+    args = parser.parse_args()
+
+    formats = Formats(elf_section(args.elf, SECTION))
+    stream = open(args.capture, "rb") if args.capture else sys.stdin.buffer
+    samples = SampleWriter(open(args.samples, "w")) if args.samples else None
+    out = sys.stdout
+    records = errors = 0
+    for part in chunks(stream):
+        try:
+            body = frame_payload(part)
+            if body[0] in (LOG, LOG_TRUNCATED):
+                if len(body) < 4:
+                    raise FrameError("short log record")
+                out.write(decode_log(body, formats) + "\n")
+                records += 1
+            elif samples is not None:
+                samples.write(decode_samples(body))
+        except FrameError as error:
+            if is_text(part):
+                out.write(part.decode("ascii"))
+            else:
+                errors += 1
+                sys.stderr.write("dlog_decode: dropped frame: %s\n" % error)
+        out.flush()
+    sys.stderr.write("dlog_decode: %d log records, %d damaged frames\n" % (records, errors))
+    return 0 if errors == 0 else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,184 @@
+/*
+ * lux_check.c - Host check of the TSL2591 integer lux conversion
+ *
+ * Runs DRV_TSL2591_LuxFromCounts (firmware/src/DRV_TSL2591_lux.c, the
+ * conversion behind DRV_TSL2591_ComputeMilliLux) for every ch0/ch1 pair
+ * below the ADC full scale of each of the 24 AGAIN x ATIME configs, next to
+ * the float formula it replaced:
+ *
+ *     lux = ((float)ch0 - ch1) * (1.0 - (float)ch1 / ch0) / cpl
+ *     cpl = atime_ms * again / 900
+ *
+ * The float result is compared before the old (int) truncation, in
+ * milli-lux, and both are also compared with the formula in double. Only
+ * ch1 < ch0 is swept: below that the integer version returns 0 by design
+ * and the float one went negative or divided by zero.
+ *
+ *     cc -O2 -I../firmware/src -o lux_check lux_check.c ../firmware/src/DRV_TSL2591_lux.c
+ *     ./lux_check [step]
+ *
+ * step takes every step-th ch1 value for a quicker run, 1 (all pairs,
+ * about 20 minutes on one core) by default. Timings are host nanoseconds
+ * per conversion and say little about the target: the 1.0 literal makes
+ * the float formula double precision, which the Cortex-M4F FPU does not
+ * have, while the host does it in hardware.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "DRV_TSL2591_lux.h"
+
+/* DRV_TSL2591.c TSL2591_MAX_COUNT_100MS and TSL2591_MAX_COUNT */
+#define MAX_COUNT_100MS     36863
+#define MAX_COUNT           65535
+
+/* Relative errors are taken where the reference is at least 1 lux */
+#define RELATIVE_FROM_MLUX  1000.0
+
+static const float againValue[TSL2591_LUX_GAINS] = { 1.0f, 25.0f, 428.0f, 9876.0f };
+
+typedef struct {
+    double absFloat;        // Max |integer - float|, milli-lux
+    double relFloat;        // Max |integer - float| / float, reference >= 1 lux
+    double absExact;        // Max |integer - exact|, milli-lux
+    double relExact;        // Max |integer - exact| / exact, reference >= 1 lux
+    double absFloatExact;   // Max |float - exact|, milli-lux, for scale
+} ERRORS;
+
+static float cplOf(int gain, int time) {
+    float atime_ms = 100.0f + 100.0f * time;
+
+    return (atime_ms * againValue[gain]) / 900.0f;
+}
+
+/* The replaced DRV_TSL2591.c expression, without its (int) cast */
+static double luxFloat(uint16_t ch0, uint16_t ch1, float cpl) {
+    return (((float) ch0-ch1) * (1.0 - (float) ch1/ch0)) / cpl;
+}
+
+static double seconds(void) {
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static void errorUpdate(double value, double reference, double* absMax, double* relMax) {
+    double e = (value > reference) ? value - reference : reference - value;
+
+    if(e > *absMax) {
+        *absMax = e;
+    }
+    if((reference >= RELATIVE_FROM_MLUX) && (e > *relMax * reference)) {
+        *relMax = e / reference;
+    }
+}
+
+/* Pair by pair, all configs whose full scale the pair is below */
+static void sweep(unsigned step, ERRORS errors[TSL2591_LUX_GAINS][TSL2591_LUX_TIMES]) {
+    float cpl[TSL2591_LUX_GAINS][TSL2591_LUX_TIMES];
+    double scale[TSL2591_LUX_GAINS][TSL2591_LUX_TIMES];
+    double unused = 0;
+    unsigned ch0, ch1;
+    double base, ratio, fixed, flt, exact;
+    int gain, time;
+
+    for(gain = 0; gain < TSL2591_LUX_GAINS; gain++) {
+        for(time = 0; time < TSL2591_LUX_TIMES; time++) {
+            cpl[gain][time] = cplOf(gain, time);
+            scale[gain][time] = 1000.0 * 900.0 / ((100.0 + 100.0 * time) * againValue[gain]);
+        }
+    }
+
+    for(ch0 = 1; ch0 < MAX_COUNT; ch0++) {
+        for(ch1 = 0; ch1 < ch0; ch1 += step) {
+            // The float expression up to its division by cpl
+            base = ((float) ch0-ch1) * (1.0 - (float) ch1/ch0);
+            ratio = ((double)ch0 - ch1) * ((double)ch0 - ch1) / ch0;
+            for(time = (ch0 < MAX_COUNT_100MS) ? 0 : 1; time < TSL2591_LUX_TIMES; time++) {
+                for(gain = 0; gain < TSL2591_LUX_GAINS; gain++) {
+                    fixed = DRV_TSL2591_LuxFromCounts(gain, time, ch0, ch1);
+                    flt = base / cpl[gain][time] * 1000.0;
+                    exact = ratio * scale[gain][time];
+                    errorUpdate(fixed, flt, &errors[gain][time].absFloat, &errors[gain][time].relFloat);
+                    errorUpdate(fixed, exact, &errors[gain][time].absExact, &errors[gain][time].relExact);
+                    errorUpdate(flt, exact, &errors[gain][time].absFloatExact, &unused);
+                }
+            }
+        }
+    }
+}
+
+/* ns per conversion over a ch0/ch1 grid, the sums keep the calls alive */
+static void timing(double* nsFixed, double* nsFloat) {
+    volatile uint32_t sinkFixed = 0;
+    volatile double sinkFloat = 0;
+    float cpl = cplOf(1, 1);
+    unsigned ch0, ch1, n = 0;
+    double t;
+
+    t = seconds();
+    for(ch0 = 1; ch0 < MAX_COUNT; ch0 += 7) {
+        for(ch1 = 0; ch1 < ch0; ch1 += 61) {
+            sinkFixed += DRV_TSL2591_LuxFromCounts(1, 1, ch0, ch1);
+            n++;
+        }
+    }
+    *nsFixed = (seconds() - t) * 1e9 / n;
+
+    t = seconds();
+    for(ch0 = 1; ch0 < MAX_COUNT; ch0 += 7) {
+        for(ch1 = 0; ch1 < ch0; ch1 += 61) {
+            sinkFloat += luxFloat(ch0, ch1, cpl);
+        }
+    }
+    *nsFloat = (seconds() - t) * 1e9 / n;
+    (void)sinkFixed;
+    (void)sinkFloat;
+}
+
+int main(int argc, char** argv) {
+    static ERRORS errors[TSL2591_LUX_GAINS][TSL2591_LUX_TIMES];
+    unsigned step = (argc > 1) ? (unsigned)strtoul(argv[1], NULL, 0) : 1U;
+    ERRORS worst = { 0 }, *e;
+    double start, elapsed, nsFixed, nsFloat;
+    int gain, time;
+
+    if(step == 0) {
+        fprintf(stderr, "usage: %s [step]\n", argv[0]);
+        return 2;
+    }
+
+    start = seconds();
+    sweep(step, errors);
+    elapsed = seconds() - start;
+
+    printf("gain  atime  vs float: max mlux  max rel   vs exact: max mlux  max rel   float vs exact: max mlux\n");
+    for(gain = 0; gain < TSL2591_LUX_GAINS; gain++) {
+        for(time = 0; time < TSL2591_LUX_TIMES; time++) {
+            e = &errors[gain][time];
+            printf("%4.0f  %3dms  %18.3f  %7.4f%%  %18.3f  %7.4f%%  %24.3f\n",
+                    againValue[gain], 100 * (time + 1),
+                    e->absFloat, e->relFloat * 100.0,
+                    e->absExact, e->relExact * 100.0,
+                    e->absFloatExact);
+            if(e->absFloat > worst.absFloat) worst.absFloat = e->absFloat;
+            if(e->relFloat > worst.relFloat) worst.relFloat = e->relFloat;
+            if(e->absExact > worst.absExact) worst.absExact = e->absExact;
+            if(e->relExact > worst.relExact) worst.relExact = e->relExact;
+            if(e->absFloatExact > worst.absFloatExact) worst.absFloatExact = e->absFloatExact;
+        }
+    }
+    printf("all         %18.3f  %7.4f%%  %18.3f  %7.4f%%  %24.3f\n",
+            worst.absFloat, worst.relFloat * 100.0,
+            worst.absExact, worst.relExact * 100.0,
+            worst.absFloatExact);
+    printf("sweep: %.1f s, ch1 step %u\n", elapsed, step);
+
+    timing(&nsFixed, &nsFloat);
+    printf("conversion: integer %.2f ns, float %.2f ns (host)\n", nsFixed, nsFloat);
+
+    return 0;
+}
@@ -0,0 +1,218 @@
+#!/usr/bin/env python3
+"""Decode the Ambient21Click binary sample telemetry into CSV.
+
+The firmware (app.c, APP_TELEMETRY_BINARY 1) sends batches of samples as
+COBS encoded frames between 0x00 delimiters. A frame payload is
+
+    type (0x01) | record count | records... | CRC-16/CCITT-FALSE (little endian)
+
+and each record is a flags byte followed by the fields whose flag is set, in
+flag order, as zigzag LEB128 deltas against the previous record of the frame
+(config is a raw byte). See APP_TELEMETRY in app.h for the flag bits.
+
+Log records (dlog.h) share the stream and are skipped here, dlog_decode.py
+formats them and writes the samples too. Anything between frames that does
+not decode, such as printf text, is passed through to stderr.
+
+    telemetry_decode.py capture.bin > samples.csv
+    telemetry_decode.py < /dev/ttyACM0 > samples.csv
+"""
+
+import argparse
+import sys
+
+FRAME_SAMPLES = 0x01
+# dlog.h DLOG_FRAME_LOG and DLOG_FRAME_LOG_TRUNCATED
+LOG = 0x02
+LOG_TRUNCATED = 0x03
+
+SEQUENCE = 0x01
+TICK = 0x02
+CH0 = 0x04
+CH1 = 0x08
+CONFIG = 0x10
+MILLILUX = 0x20
+LUX_INVALID = 0x40
+
+
+class FrameError(Exception):
+    pass
+
+
+def cobs_decode(data):
+    out = bytearray()
+    i = 0
+    while i < len(data):
+        code = data[i]
+        if code == 0 or i + code > len(data):
+            raise FrameError("bad COBS code")
+        out += data[i + 1:i + code]
+        i += code
+        if code < 0xFF and i < len(data):
+            out.append(0)
+    return bytes(out)
+
+
+def crc16(data):
+    crc = 0xFFFF
+    for byte in data:
+        crc ^= byte << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) if crc & 0x8000 else (crc << 1)
+            crc &= 0xFFFF
+    return crc
+
+
+def varint(payload, pos):
+    value = 0
+    shift = 0
+    while True:
+        if pos >= len(payload) or shift > 28:
+            raise FrameError("truncated varint")
+        byte = payload[pos]
+        pos += 1
+        value |= (byte & 0x7F) << shift
+        shift += 7
+        if not byte & 0x80:
+            break
+    # Undo zigzag, then wrap to a signed 32-bit delta
+    value = (value >> 1) ^ -(value & 1)
+    return value, pos
+
+
+def frame_payload(frame):
+    """COBS decode a frame and check its CRC, returns the payload without it."""
+    payload = cobs_decode(frame)
+    if len(payload) < 3:
+        raise FrameError("short frame")
+    if crc16(payload[:-2]) != payload[-2] | (payload[-1] << 8):
+        raise FrameError("CRC mismatch")
+    return payload[:-2]
+
+
+def decode_samples(body):
+    if body[0] != FRAME_SAMPLES:
+        raise FrameError("unknown frame type 0x%02x" % body[0])
+    if len(body) < 2:
+        raise FrameError("short frame")
+
+    count = body[1]
+    pos = 2
+    # Same predictions as APP_TelemetryFrameStart
+    sequence = 0xFFFFFFFF
+    tick = 0
+    interval = 0
+    ch0 = ch1 = config = millilux = 0
+    records = []
+    for index in range(count):
+        if pos >= len(body):
+            raise FrameError("truncated record")
+        flags = body[pos]
+        pos += 1
+        delta = 0
+        if flags & SEQUENCE:
+            delta, pos = varint(body, pos)
+        sequence = (sequence + 1 + delta) & 0xFFFFFFFF
+        delta = 0
+        if flags & TICK:
+            delta, pos = varint(body, pos)
+        step = (interval + delta) & 0xFFFFFFFF
+        tick = (tick + step) & 0xFFFFFFFF
+        interval = 0 if index == 0 else step
+        if flags & CH0:
+            delta, pos = varint(body, pos)
+            ch0 = (ch0 + delta) & 0xFFFF
+        if flags & CH1:
+            delta, pos = varint(body, pos)
+            ch1 = (ch1 + delta) & 0xFFFF
+        if flags & CONFIG:
+            if pos >= len(body):
+                raise FrameError("truncated record")
+            config = body[pos]
+            pos += 1
+        if flags & MILLILUX:
+            delta, pos = varint(body, pos)
+            millilux = (millilux + delta) & 0xFFFFFFFF
+        lux = "" if flags & LUX_INVALID else str(millilux)
+        records.append((sequence, tick, ch0, ch1, config, lux))
+    if pos != len(body):
+        raise FrameError("trailing bytes")
+    return records
+
+
+def is_text(part):
+    return all(32 <= b < 127 or b in (9, 10, 13) for b in part)
+
+
+def chunks(stream):
+    """Yield what lies between 0x00 delimiters, the tail once the stream ends."""
+    pending = bytearray()
+    while True:
+        chunk = stream.read1(4096) if hasattr(stream, "read1") else stream.read(4096)
+        if not chunk:
+            break
+        pending += chunk
+        parts = pending.split(b"\x00")
+        pending = bytearray(parts.pop())
+        for part in parts:
+            if part:
+                yield bytes(part)
+    if pending:
+        yield bytes(pending)
+
+
+class SampleWriter:
+    """CSV output of the sample frames, counting sequence gaps."""
+
+    HEADER = "sequence,tick,ch0,ch1,config,millilux\n"
+
+    def __init__(self, out):
+        self.out = out
+        self.last_sequence = None
+        self.lost = 0
+        out.write(self.HEADER)
+
+    def write(self, records):
+        for record in records:
+            if self.last_sequence is not None:
+                self.lost += (record[0] - self.last_sequence - 1) & 0xFFFFFFFF
+            self.last_sequence = record[0]
+            self.out.write("%d,%d,%d,%d,0x%02x,%s\n" % record)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("capture", nargs="?", help="raw UART capture, stdin if omitted")
+    parser.add_argument("-q", "--quiet", action="store_true", help="drop the text lines instead of echoing them to stderr")
+    args = parser.parse_args()
+
+    stream = open(args.capture, "rb") if args.capture else sys.stdin.buffer
+    samples = SampleWriter(sys.stdout)
+    frames = logs = errors = 0
+    for part in chunks(stream):
+        try:
+            body = frame_payload(part)
+            if body[0] in (LOG, LOG_TRUNCATED):
+                # Log records need the ELF, see dlog_decode.py
+                logs += 1
+                continue
+            records = decode_samples(body)
+        except FrameError as error:
+            # Text between frames is printable, anything else is a damaged frame
+            if is_text(part):
+                if not args.quiet:
+                    sys.stderr.write(part.decode("ascii"))
+            else:
+                errors += 1
+                sys.stderr.write("telemetry_decode: dropped frame: %s\n" % error)
+            continue
+        frames += 1
+        samples.write(records)
+        sys.stdout.flush()
+    sys.stderr.write("telemetry_decode: %d frames, %d log records skipped, %d damaged, %d samples lost on target\n"
+                     % (frames, logs, errors, samples.lost))
+    return 0 if errors == 0 else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())